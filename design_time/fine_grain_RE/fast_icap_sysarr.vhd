@@ -31,6 +31,7 @@ ENTITY fast_icap_sysarr IS
    port (
       -- Users to add ports here
       Icap_Clk      : in  std_logic;
+      Irq           : out std_logic; -- Active high level interrupt (see s_axi_ctrl)
       -- User ports ends
       -- Do not modify the ports beyond this line
 
@@ -151,6 +152,7 @@ S_AXI_CTRL_INST : entity work.s_axi_ctrl
       Start      => start,
       Ack        => ack,
       Ready      => ready,
+      Irq        => Irq,
       Cfg        => cfg,
       Frame_addr => frame_addr,
       Cfg_words  => cfg_words,
@@ -19,6 +19,9 @@ ENTITY s_axi_ctrl IS
       -- Users to add ports here
       Start      : out std_logic;
       Ack, Ready : in  std_logic;
+      -- Level interrupt enabled with slv_reg14: bit 0 while a new XFAR can be 
+      -- written (Ack = Start) and bit 1 while the RE is idle (Ready = Ack = Start)
+      Irq        : out std_logic;
       -- The cfg vector should have enough bits to define all the elements of the most 
       -- restrictive configuration type, which is the constant reconfiguration. The 
       -- constant reconfiguration needs 4bits*100elements = 400bits
@@ -139,12 +142,14 @@ ARCHITECTURE arch_imp OF s_axi_ctrl IS
    signal slv_reg11	   : std_logic_vector (C_S_AXI_DATA_WIDTH-1 downto 0);
    signal slv_reg12	   : std_logic_vector (C_S_AXI_DATA_WIDTH-1 downto 0);
    signal slv_reg13	   : std_logic_vector (C_S_AXI_DATA_WIDTH-1 downto 0);
+   signal slv_reg14	   : std_logic_vector (C_S_AXI_DATA_WIDTH-1 downto 0);
    signal slv_reg_rden : std_logic;
    signal slv_reg_wren : std_logic;
    signal reg_data_out : std_logic_vector (C_S_AXI_DATA_WIDTH-1 downto 0);
    signal byte_index   : integer;
    
    signal start_s : std_logic;
+   signal irq_s   : std_logic;
 
 BEGIN
 
@@ -252,6 +257,7 @@ begin
       slv_reg11 <= (others => '0');
       slv_reg12 <= (others => '0');
       slv_reg13 <= (others => '0');
+      slv_reg14 <= (others => '0');
       start_s  <= '0';
     else
       loc_addr := axi_awaddr(ADDR_LSB + OPT_MEM_ADDR_BITS downto ADDR_LSB);
@@ -370,6 +376,14 @@ begin
 	                slv_reg13(byte_index*8+7 downto byte_index*8) <= S_AXI_WDATA(byte_index*8+7 downto byte_index*8);
 	              end if;
 	            end loop;
+	          when b"1110" =>
+	            for byte_index in 0 to (C_S_AXI_DATA_WIDTH/8-1) loop
+	              if ( S_AXI_WSTRB(byte_index) = '1' ) then
+	                -- Respective byte enables are asserted as per write strobes                   
+	                -- slave registor 14
+	                slv_reg14(byte_index*8+7 downto byte_index*8) <= S_AXI_WDATA(byte_index*8+7 downto byte_index*8);
+	              end if;
+	            end loop;
           when others =>
             null;
         end case;
@@ -459,7 +473,7 @@ end process;
 -- and the slave is ready to accept the read address.
 slv_reg_rden <= axi_arready and S_AXI_ARVALID and (not axi_rvalid) ;
 
-process (slv_reg0_out, slv_reg1, slv_reg2, slv_reg3, slv_reg4, slv_reg5, slv_reg6, slv_reg7, slv_reg8, slv_reg9, slv_reg10, slv_reg11, slv_reg12, slv_reg13, axi_araddr, S_AXI_ARESETN, slv_reg_rden)
+process (slv_reg0_out, slv_reg1, slv_reg2, slv_reg3, slv_reg4, slv_reg5, slv_reg6, slv_reg7, slv_reg8, slv_reg9, slv_reg10, slv_reg11, slv_reg12, slv_reg13, slv_reg14, axi_araddr, S_AXI_ARESETN, slv_reg_rden)
    variable loc_addr :std_logic_vector(OPT_MEM_ADDR_BITS downto 0);
 begin
    -- Address decoding for reading registers
@@ -493,6 +507,8 @@ begin
         reg_data_out <= slv_reg12;
       when b"1101" =>
         reg_data_out <= slv_reg13;
+      when b"1110" =>
+        reg_data_out <= slv_reg14;
       when others =>
         reg_data_out  <= (others => '0');
     end case;
@@ -525,6 +541,23 @@ slv_reg0_out(slv_reg0_out'left downto 2) <= (others => '0');
 slv_reg0_out(1) <= '0' when Ack = start_s and Ready = start_s else '1';
 slv_reg0_out(0) <= '0' when Ack = start_s else '1';
 
+-- The interrupt is registered to avoid glitches in the IRQ_F2P line.
+process (S_AXI_ACLK) is
+begin
+  if rising_edge(S_AXI_ACLK) then
+    if S_AXI_ARESETN = '0' then
+      irq_s <= '0';
+    elsif (slv_reg14(0) = '1' and Ack = start_s) or
+          (slv_reg14(1) = '1' and Ack = start_s and Ready = start_s) then
+      irq_s <= '1';
+    else
+      irq_s <= '0';
+    end if;
+  end if;
+end process;
+
+Irq <= irq_s;
+
 -- The register slv_reg0_in is divided in:
 --    · slv_reg0_in(25 downto 0): first frame address to reconfigure.
 --    · slv_reg0_in(29 downto 26): number of consecutive frame address to reconfigure. 
@@ -0,0 +1,77 @@
+import sys
+import struct
+
+'''
+This script packs the partial bitstreams (pbs) of all the elements in a single image that is
+written in a raw partition of the SD card (run_time/PBS_store.h). The run-time reads the pbs
+directly from the partition sectors instead of using the FAT file system.
+
+The script should be called with at least 2 arguments:
+    param argv[1]: destination image file
+    param argv[2:]: pbs files ordered by element number (i.e. in the same order as the elements
+                    variable in IMPRESS_reconfiguration_parameters.c). If there is a geometry file
+                    generated by generate_partial_bitstream.py (pbs file name + ".toc") it is
+                    added to the table of contents of the image.
+
+    return: returns the image in the destination file defined in argv[1]
+
+    Example: python build_PBS_store.py ./PBS_store.img ./adder.pbs ./mult.pbs
+
+    The image can be written in the SD card with:
+        dd if=PBS_store.img of=/dev/sdX bs=512 seek=PBS_STORE_FIRST_SECTOR
+
+NOTE: the pbs words are byte swapped so they are stored in the order they are sent to the PCAP.
+'''
+
+SECTOR_BYTES = 512
+MAGIC = 0x50425353
+VERSION = 3
+HEADER_WORDS = 3
+MAX_ROWS = 7  # PBS_STORE_MAX_ROWS (MAX_ROWS of run_time/FPGA_templates/device.h)
+ENTRY_WORDS = 9 + MAX_ROWS
+
+
+def sectors(num_bytes):
+    return (num_bytes + SECTOR_BYTES - 1) // SECTOR_BYTES
+
+
+def read_geometry(pbs_file, pbs_bytes):
+    # Returns [x0, y0, xf, yf, num_rows, row_bytes...] or no geometry if it is not available
+    try:
+        with open(pbs_file + ".toc", 'r') as file:
+            pblock = [int(value) for value in file.readline().split()]
+            row_bytes = [int(value) for value in file.readline().split()]
+    except IOError:
+        return [0] * (5 + MAX_ROWS)
+    if len(pblock) != 4 or len(row_bytes) > MAX_ROWS or sum(row_bytes) != pbs_bytes:
+        sys.exit("ERROR: " + pbs_file + ".toc does not describe " + pbs_file)
+    return pblock + [len(row_bytes)] + row_bytes + [0] * (MAX_ROWS - len(row_bytes))
+
+
+destination_file = sys.argv[1]
+pbs_files = sys.argv[2:]
+
+pbs_list = []
+for pbs_file in pbs_files:
+    with open(pbs_file, 'rb') as file:
+        data = file.read()
+    if len(data) % 4 != 0:
+        sys.exit("ERROR: " + pbs_file + " size is not a multiple of 4 bytes")
+    num_words = len(data) // 4
+    words = struct.unpack('>%dI' % num_words, data)
+    pbs_list.append((struct.pack('<%dI' % num_words, *words), sum(words) & 0xFFFFFFFF, read_geometry(pbs_file, len(data))))
+
+# Each pbs starts at a sector boundary after the header and the index
+index = []
+sector = sectors((HEADER_WORDS + ENTRY_WORDS * len(pbs_list)) * 4)
+for element, (data, checksum, geometry) in enumerate(pbs_list):
+    index.append([element, sector, len(data), checksum] + geometry)
+    sector += sectors(len(data))
+
+with open(destination_file, 'wb') as file:
+    header = struct.pack('<3I', MAGIC, VERSION, len(pbs_list))
+    for entry in index:
+        header += struct.pack('<%dI' % ENTRY_WORDS, *entry)
+    file.write(header + b'\0' * (sectors(len(header)) * SECTOR_BYTES - len(header)))
+    for data, checksum, geometry in pbs_list:
+        file.write(data + b'\0' * (sectors(len(data)) * SECTOR_BYTES - len(data)))
@@ -18,6 +18,9 @@ The script should be called with 3 arguments:
     param argv[3]: partial bitstream destination file name.
     
     return: returns an extracted pbs located in the destination file defined in argv[3] 
+            and its geometry in argv[3] + ".toc" (used by build_PBS_store.py). The geometry
+            file contains the pblock (x0 y0 xf yf) in the first line and the bytes of each 
+            clock region row in the second line. 
     
     Example: python generate_partial_bitstream ./static.bit X3Y5:X8Y12 ./module.pbs
     
@@ -45,6 +48,7 @@ words_per_half_clock_region_without_clock = (frame_words_num - clock_word_num) /
 
 extracted_bitstream = bytearray()
 extracted_BRAM_contents = bytearray()
+row_bytes = []
     
 for pblock_definition in pblock_definition_list.split():
     expression = re.search("X([0-9]+)Y([0-9]+):X([0-9]+)Y([0-9]+)", pblock_definition)
@@ -57,6 +61,7 @@ for pblock_definition in pblock_definition_list.split():
     last_clock_region_row = yf / rows_per_clock_region 
 
     for i in range(first_clock_region_row, last_clock_region_row + 1):
+        row_first_byte = len(extracted_bitstream)
         first_words_not_used = 0
         last_words_not_used = 0
         if (i == first_clock_region_row):
@@ -97,6 +102,7 @@ for pblock_definition in pblock_definition_list.split():
             extracted_BRAM_contents.extend(bitstream_obj.obtain_BRAM_contents((i, slice(x0, (xf + 1)), slice(first_words_not_used, last_word))))
         else: 
             print "error"
+        row_bytes.append(len(extracted_bitstream) - row_first_byte)
 
 
 # for i in xrange(0, len(extracted_BRAM_contents)):
@@ -116,4 +122,10 @@ for pblock_definition in pblock_definition_list.split():
 #     file.write(sys.argv[3])
  
 with open(destination_file, 'wb') as file:
-    file.write(extracted_bitstream) 
\ No newline at end of file
+    file.write(extracted_bitstream)
+
+# The geometry is only described for pbs extracted from a single pblock
+if len(pblock_definition_list.split()) == 1:
+    with open(destination_file + ".toc", 'w') as file:
+        file.write("%d %d %d %d\n" % (x0, y0, xf, yf))
+        file.write(" ".join(str(num_bytes) for num_bytes in row_bytes) + "\n")
@@ -16,6 +16,10 @@
     #define MAX_COLUMNS_MUX                 1
     #define MAX_COLUMNS_FU                  1
     #define MAX_COLUMN_OFFSETS              1
+    #define MAX_CLOCK_ROWS_PER_ELEMENT      1 // The elements are placed inside one clock region row (more rows need bigger layouts)
+    #define MAX_MUX_INPUTS                  2
+    #define MAX_FINE_GRAIN_PARTITIONS       2
+    #define MAX_FU_USER_FUNCTIONS           1
   #endif
 
 #define MODULE_TOP			0
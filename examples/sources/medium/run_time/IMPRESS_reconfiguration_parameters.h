@@ -16,6 +16,10 @@
     #define MAX_COLUMNS_MUX                 0
     #define MAX_COLUMNS_FU                  1
     #define MAX_COLUMN_OFFSETS              2
+    #define MAX_CLOCK_ROWS_PER_ELEMENT      1 // The elements are placed inside one clock region row (more rows need bigger layouts)
+    #define MAX_MUX_INPUTS                  4
+    #define MAX_FINE_GRAIN_PARTITIONS       1
+    #define MAX_FU_USER_FUNCTIONS           1
   #endif
 
   #define GROUP1_ADD		0
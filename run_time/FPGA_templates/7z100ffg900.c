@@ -9,1954 +9,1106 @@
 #define ROW3   3
 #define ROW4   4
 #define ROW5   5
-#define ROW6   6
-// ID generation
-#define block(top, row, type)  ((top<<24) | (row<<16) | (type))
-#define content(yes_no, major)  ((yes_no<<16) | (major))
 
 
-
-const u32 fpga[MAX_ROWS][MAX_COLUMNS][2] = {
+// Columns of each clock region row (type, frames, BRAM major)
+static const device_column_t columns[XC7Z100_ROWS][XC7Z100_COLUMNS] = {
   {
-    {block(BOTTOM, ROW5, IOB_A), IOBA_TYPE},
-    {block(BOTTOM, ROW5, IOB_B), IOBB_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CFG), CFG_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLK), CLK_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW5, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW5, GT), GT_TYPE}
+    {IOBA_TYPE, IOB_A, DEVICE_NO_BRAM, 0},
+    {IOBB_TYPE, IOB_B, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 0, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 1, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 2, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 3, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 4, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CFG_TYPE, CFG, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 5, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLK_TYPE, CLK, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 6, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 7, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 8, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 9, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 10, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {GT_TYPE, GT, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0}
   },
   {
-    {block(BOTTOM, ROW4, IOB_A), IOBA_TYPE},
-    {block(BOTTOM, ROW4, IOB_B), IOBB_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CFG), CFG_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLK), CLK_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW4, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW4, GT), GT_TYPE}
+    {IOBA_TYPE, IOB_A, DEVICE_NO_BRAM, 0},
+    {IOBB_TYPE, IOB_B, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 0, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 1, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 2, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 3, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 4, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CFG_TYPE, CFG, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 5, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLK_TYPE, CLK, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 6, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 7, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 8, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 9, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 10, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {GT_TYPE, GT, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0}
   },
   {
-    {block(BOTTOM, ROW3, IOB_A), IOBA_TYPE},
-    {block(BOTTOM, ROW3, IOB_B), IOBB_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CFG), CFG_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLK), CLK_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW3, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW3, GT), GT_TYPE}
+    {IOBA_TYPE, IOB_A, DEVICE_NO_BRAM, 0},
+    {IOBB_TYPE, IOB_B, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 0, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 1, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 2, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 3, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 4, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CFG_TYPE, CFG, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 5, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLK_TYPE, CLK, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 6, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 7, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 8, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 9, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 10, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {GT_TYPE, GT, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0}
   },
   {
-    {block(BOTTOM, ROW2, IOB_A), IOBA_TYPE},
-    {block(BOTTOM, ROW2, IOB_B), IOBB_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CFG), CFG_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLK), CLK_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW2, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW2, GT), GT_TYPE}
+    {IOBA_TYPE, IOB_A, DEVICE_NO_BRAM, 0},
+    {IOBB_TYPE, IOB_B, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 0, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 1, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 2, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 3, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 4, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CFG_TYPE, CFG, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 5, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLK_TYPE, CLK, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 6, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 7, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 8, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 9, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 10, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {GT_TYPE, GT, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0},
+    {NONE_TYPE, 0, DEVICE_NO_BRAM, 0}
   },
   {
-    {block(BOTTOM, ROW1, IOB_A), IOBA_TYPE},
-    {block(BOTTOM, ROW1, IOB_B), IOBB_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CFG), CFG_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLK), CLK_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW1, IOB_B), IOBB_TYPE},
-    {block(BOTTOM, ROW1, IOB_A), IOBA_TYPE}
+    {IOBA_TYPE, IOB_A, DEVICE_NO_BRAM, 0},
+    {IOBB_TYPE, IOB_B, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 0, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 1, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 2, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 3, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 4, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CFG_TYPE, CFG, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 5, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLK_TYPE, CLK, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 6, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 7, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 8, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 9, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 10, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 11, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {IOBB_TYPE, IOB_B, DEVICE_NO_BRAM, 0},
+    {IOBA_TYPE, IOB_A, DEVICE_NO_BRAM, 0}
   },
   {
-    {block(BOTTOM, ROW0, IOB_A), IOBA_TYPE},
-    {block(BOTTOM, ROW0, IOB_B), IOBB_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CFG), CFG_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLK), CLK_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, DSP), DSP_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-    {block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-    {block(BOTTOM, ROW0, IOB_B), IOBB_TYPE},
-    {block(BOTTOM, ROW0, IOB_A), IOBA_TYPE}
+    {IOBA_TYPE, IOB_A, DEVICE_NO_BRAM, 0},
+    {IOBB_TYPE, IOB_B, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 0, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 1, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 2, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 3, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 4, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CFG_TYPE, CFG, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 5, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLK_TYPE, CLK, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 6, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 7, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 8, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 9, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 10, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 11, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {IOBB_TYPE, IOB_B, DEVICE_NO_BRAM, 0},
+    {IOBA_TYPE, IOB_A, DEVICE_NO_BRAM, 0}
   },
   {
-    {block(TOP, ROW0, IOB_A), IOBA_TYPE},
-    {block(TOP, ROW0, IOB_B), IOBB_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, BRAM), BRAM_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, DSP), DSP_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, DSP), DSP_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, BRAM), BRAM_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, BRAM), BRAM_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, DSP), DSP_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, DSP), DSP_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, BRAM), BRAM_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, DSP), DSP_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, DSP), DSP_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, BRAM), BRAM_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CFG), CFG_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, DSP), DSP_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, BRAM), BRAM_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, DSP), DSP_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLK), CLK_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, DSP), DSP_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, BRAM), BRAM_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, DSP), DSP_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, DSP), DSP_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, BRAM), BRAM_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, DSP), DSP_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, DSP), DSP_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, BRAM), BRAM_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, DSP), DSP_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, BRAM), BRAM_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, BRAM), BRAM_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, DSP), DSP_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, BRAM), BRAM_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, CLB), CLB_L_TYPE},
-    {block(TOP, ROW0, CLB), CLB_M_TYPE},
-    {block(TOP, ROW0, IOB_B), IOBB_TYPE},
-    {block(TOP, ROW0, IOB_A), IOBA_TYPE}
+    {IOBA_TYPE, IOB_A, DEVICE_NO_BRAM, 0},
+    {IOBB_TYPE, IOB_B, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 0, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 1, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 2, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 3, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 4, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CFG_TYPE, CFG, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 5, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLK_TYPE, CLK, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 6, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 7, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 8, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 9, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 10, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {BRAM_TYPE, BRAM, 11, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+    {IOBB_TYPE, IOB_B, DEVICE_NO_BRAM, 0},
+    {IOBA_TYPE, IOB_A, DEVICE_NO_BRAM, 0}
   }
 };
-const u32 fpga_bram[MAX_ROWS][MAX_COLUMNS] = {
+
+// Frames before each column of a clock region row (the last position
+// contains the frames of the whole row)
+static const u16 frame_offset[XC7Z100_ROWS][XC7Z100_COLUMNS + 1] = {
   {
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 1),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 2),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 3),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 4),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 5),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 6),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 7),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 8),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 9),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 10),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0)
+    0, 42, 72, 108, 144, 180, 216, 244, 280, 316, 344, 380, 416, 452, 488, 516,
+    552, 588, 616, 652, 688, 724, 760, 788, 824, 860, 888, 924, 960, 996, 1032, 1068,
+    1096, 1132, 1168, 1196, 1232, 1268, 1296, 1332, 1368, 1404, 1440, 1468, 1504, 1540, 1568, 1604,
+    1640, 1676, 1712, 1748, 1784, 1814, 1850, 1886, 1922, 1958, 1986, 2022, 2058, 2086, 2122, 2158,
+    2186, 2222, 2258, 2294, 2330, 2366, 2396, 2432, 2468, 2504, 2540, 2576, 2612, 2648, 2684, 2720,
+    2748, 2784, 2820, 2848, 2884, 2920, 2948, 2984, 3020, 3056, 3092, 3128, 3164, 3200, 3236, 3272,
+    3308, 3336, 3372, 3408, 3436, 3472, 3508, 3536, 3572, 3608, 3644, 3680, 3716, 3752, 3788, 3816,
+    3852, 3888, 3916, 3952, 3988, 4024, 4052, 4088, 4124, 4152, 4188, 4224, 4260, 4296, 4332, 4360,
+    4396, 4432, 4460, 4496, 4532, 4568, 4600, 4600, 4600, 4600, 4600, 4600, 4600
   },
   {
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 1),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 2),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 3),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 4),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 5),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 6),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 7),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 8),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 9),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 10),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0)
+    0, 42, 72, 108, 144, 180, 216, 244, 280, 316, 344, 380, 416, 452, 488, 516,
+    552, 588, 616, 652, 688, 724, 760, 788, 824, 860, 888, 924, 960, 996, 1032, 1068,
+    1096, 1132, 1168, 1196, 1232, 1268, 1296, 1332, 1368, 1404, 1440, 1468, 1504, 1540, 1568, 1604,
+    1640, 1676, 1712, 1748, 1784, 1814, 1850, 1886, 1922, 1958, 1986, 2022, 2058, 2086, 2122, 2158,
+    2186, 2222, 2258, 2294, 2330, 2366, 2396, 2432, 2468, 2504, 2540, 2576, 2612, 2648, 2684, 2720,
+    2748, 2784, 2820, 2848, 2884, 2920, 2948, 2984, 3020, 3056, 3092, 3128, 3164, 3200, 3236, 3272,
+    3308, 3336, 3372, 3408, 3436, 3472, 3508, 3536, 3572, 3608, 3644, 3680, 3716, 3752, 3788, 3816,
+    3852, 3888, 3916, 3952, 3988, 4024, 4052, 4088, 4124, 4152, 4188, 4224, 4260, 4296, 4332, 4360,
+    4396, 4432, 4460, 4496, 4532, 4568, 4600, 4600, 4600, 4600, 4600, 4600, 4600
   },
   {
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 1),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 2),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 3),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 4),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 5),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 6),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 7),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 8),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 9),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 10),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0)
+    0, 42, 72, 108, 144, 180, 216, 244, 280, 316, 344, 380, 416, 452, 488, 516,
+    552, 588, 616, 652, 688, 724, 760, 788, 824, 860, 888, 924, 960, 996, 1032, 1068,
+    1096, 1132, 1168, 1196, 1232, 1268, 1296, 1332, 1368, 1404, 1440, 1468, 1504, 1540, 1568, 1604,
+    1640, 1676, 1712, 1748, 1784, 1814, 1850, 1886, 1922, 1958, 1986, 2022, 2058, 2086, 2122, 2158,
+    2186, 2222, 2258, 2294, 2330, 2366, 2396, 2432, 2468, 2504, 2540, 2576, 2612, 2648, 2684, 2720,
+    2748, 2784, 2820, 2848, 2884, 2920, 2948, 2984, 3020, 3056, 3092, 3128, 3164, 3200, 3236, 3272,
+    3308, 3336, 3372, 3408, 3436, 3472, 3508, 3536, 3572, 3608, 3644, 3680, 3716, 3752, 3788, 3816,
+    3852, 3888, 3916, 3952, 3988, 4024, 4052, 4088, 4124, 4152, 4188, 4224, 4260, 4296, 4332, 4360,
+    4396, 4432, 4460, 4496, 4532, 4568, 4600, 4600, 4600, 4600, 4600, 4600, 4600
   },
   {
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 1),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 2),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 3),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 4),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 5),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 6),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 7),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 8),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 9),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 10),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0)
+    0, 42, 72, 108, 144, 180, 216, 244, 280, 316, 344, 380, 416, 452, 488, 516,
+    552, 588, 616, 652, 688, 724, 760, 788, 824, 860, 888, 924, 960, 996, 1032, 1068,
+    1096, 1132, 1168, 1196, 1232, 1268, 1296, 1332, 1368, 1404, 1440, 1468, 1504, 1540, 1568, 1604,
+    1640, 1676, 1712, 1748, 1784, 1814, 1850, 1886, 1922, 1958, 1986, 2022, 2058, 2086, 2122, 2158,
+    2186, 2222, 2258, 2294, 2330, 2366, 2396, 2432, 2468, 2504, 2540, 2576, 2612, 2648, 2684, 2720,
+    2748, 2784, 2820, 2848, 2884, 2920, 2948, 2984, 3020, 3056, 3092, 3128, 3164, 3200, 3236, 3272,
+    3308, 3336, 3372, 3408, 3436, 3472, 3508, 3536, 3572, 3608, 3644, 3680, 3716, 3752, 3788, 3816,
+    3852, 3888, 3916, 3952, 3988, 4024, 4052, 4088, 4124, 4152, 4188, 4224, 4260, 4296, 4332, 4360,
+    4396, 4432, 4460, 4496, 4532, 4568, 4600, 4600, 4600, 4600, 4600, 4600, 4600
   },
   {
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 1),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 2),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 3),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 4),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 5),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 6),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 7),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 8),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 9),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 10),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 11),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0)
+    0, 42, 72, 108, 144, 180, 216, 244, 280, 316, 344, 380, 416, 452, 488, 516,
+    552, 588, 616, 652, 688, 724, 760, 788, 824, 860, 888, 924, 960, 996, 1032, 1068,
+    1096, 1132, 1168, 1196, 1232, 1268, 1296, 1332, 1368, 1404, 1440, 1468, 1504, 1540, 1568, 1604,
+    1640, 1676, 1712, 1748, 1784, 1814, 1850, 1886, 1922, 1958, 1986, 2022, 2058, 2086, 2122, 2158,
+    2186, 2222, 2258, 2294, 2330, 2366, 2396, 2432, 2468, 2504, 2540, 2576, 2612, 2648, 2684, 2720,
+    2748, 2784, 2820, 2848, 2884, 2920, 2948, 2984, 3020, 3056, 3092, 3128, 3164, 3200, 3236, 3272,
+    3308, 3336, 3372, 3408, 3436, 3472, 3508, 3536, 3572, 3608, 3644, 3680, 3716, 3752, 3788, 3816,
+    3852, 3888, 3916, 3952, 3988, 4024, 4052, 4088, 4124, 4152, 4188, 4224, 4260, 4296, 4332, 4360,
+    4396, 4432, 4460, 4496, 4532, 4568, 4596, 4632, 4668, 4704, 4740, 4770, 4812
   },
   {
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 1),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 2),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 3),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 4),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 5),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 6),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 7),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 8),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 9),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 10),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 11),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0)
+    0, 42, 72, 108, 144, 180, 216, 244, 280, 316, 344, 380, 416, 452, 488, 516,
+    552, 588, 616, 652, 688, 724, 760, 788, 824, 860, 888, 924, 960, 996, 1032, 1068,
+    1096, 1132, 1168, 1196, 1232, 1268, 1296, 1332, 1368, 1404, 1440, 1468, 1504, 1540, 1568, 1604,
+    1640, 1676, 1712, 1748, 1784, 1814, 1850, 1886, 1922, 1958, 1986, 2022, 2058, 2086, 2122, 2158,
+    2186, 2222, 2258, 2294, 2330, 2366, 2396, 2432, 2468, 2504, 2540, 2576, 2612, 2648, 2684, 2720,
+    2748, 2784, 2820, 2848, 2884, 2920, 2948, 2984, 3020, 3056, 3092, 3128, 3164, 3200, 3236, 3272,
+    3308, 3336, 3372, 3408, 3436, 3472, 3508, 3536, 3572, 3608, 3644, 3680, 3716, 3752, 3788, 3816,
+    3852, 3888, 3916, 3952, 3988, 4024, 4052, 4088, 4124, 4152, 4188, 4224, 4260, 4296, 4332, 4360,
+    4396, 4432, 4460, 4496, 4532, 4568, 4596, 4632, 4668, 4704, 4740, 4770, 4812
   },
   {
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 1),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 2),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 3),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 4),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 5),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 6),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 7),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 8),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 9),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 10),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_CONTENT, 11),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0),
-   content(BRAM_NOCONTENT, 0)
+    0, 42, 72, 108, 144, 180, 216, 244, 280, 316, 344, 380, 416, 452, 488, 516,
+    552, 588, 616, 652, 688, 724, 760, 788, 824, 860, 888, 924, 960, 996, 1032, 1068,
+    1096, 1132, 1168, 1196, 1232, 1268, 1296, 1332, 1368, 1404, 1440, 1468, 1504, 1540, 1568, 1604,
+    1640, 1676, 1712, 1748, 1784, 1814, 1850, 1886, 1922, 1958, 1986, 2022, 2058, 2086, 2122, 2158,
+    2186, 2222, 2258, 2294, 2330, 2366, 2396, 2432, 2468, 2504, 2540, 2576, 2612, 2648, 2684, 2720,
+    2748, 2784, 2820, 2848, 2884, 2920, 2948, 2984, 3020, 3056, 3092, 3128, 3164, 3200, 3236, 3272,
+    3308, 3336, 3372, 3408, 3436, 3472, 3508, 3536, 3572, 3608, 3644, 3680, 3716, 3752, 3788, 3816,
+    3852, 3888, 3916, 3952, 3988, 4024, 4052, 4088, 4124, 4152, 4188, 4224, 4260, 4296, 4332, 4360,
+    4396, 4432, 4460, 4496, 4532, 4568, 4596, 4632, 4668, 4704, 4740, 4770, 4812
   }
 };
+
+// FAR of the first frame of each clock region row
+static const u32 far[XC7Z100_ROWS] = {
+  far_base(BOTTOM, ROW5),
+  far_base(BOTTOM, ROW4),
+  far_base(BOTTOM, ROW3),
+  far_base(BOTTOM, ROW2),
+  far_base(BOTTOM, ROW1),
+  far_base(BOTTOM, ROW0),
+  far_base(TOP, ROW0)
+};
+
+const device_t xc7z100_device = {
+  XC7Z100_IDCODE,
+  "xc7z100",
+  XC7Z100_ROWS,
+  XC7Z100_COLUMNS,
+  &columns[0][0],
+  &frame_offset[0][0],
+  far,
+  &series7_family
+};
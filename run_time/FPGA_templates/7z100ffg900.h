@@ -1,32 +1,14 @@
-#ifndef FPGA_NAME_H
-#define FPGA_NAME_H
+#ifndef XC7Z100_H
+#define XC7Z100_H
 
 
-#include "series7.h"
-#include "xil_types.h"
+#include "device.h"
 
-// BRAM content definitions
-#define BRAM_CONTENT   1
-#define BRAM_NOCONTENT 0
+#define XC7Z100_ROWS    7
+#define XC7Z100_COLUMNS 140
 
-// Block type definition
-#define CLB_L_TYPE 		0
-#define CLB_M_TYPE 		1
-#define DSP_TYPE 			2
-#define BRAM_TYPE 		3
-#define IOBA_TYPE 		4
-#define IOBB_TYPE 		5
-#define CLK_TYPE 			6
-#define CFG_TYPE			7
-#define GT_TYPE 			8
+#define XC7Z100_IDCODE 0x03736093
 
-#define MAX_ROWS    7
-#define MAX_COLUMNS 352
-
-#define PCAP_IDCODE_NUMBER 0x03736093
-
-extern const u32 fpga[MAX_ROWS][MAX_COLUMNS][2];
-
-extern const u32 fpga_bram[MAX_ROWS][MAX_COLUMNS];
+extern const device_t xc7z100_device;
 
 #endif
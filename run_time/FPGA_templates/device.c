@@ -0,0 +1,48 @@
+/*
+ * device.c
+ *
+ * Device families, list of the supported devices and selection of the device
+ * description
+ */
+
+#include "device.h"
+#include "xc7z020.h"
+#include "7z100ffg900.h"
+#ifndef PCAP_LINUX
+#include "xstatus.h"
+#endif
+
+const device_family_t series7_family = {
+	"7 series",
+	NUM_FRAME_WORDS,
+	CLOCK_WORDS,
+	ROWS_PER_CLOCK_REGION,
+	1,
+	WORDS_PER_ROW_IN_CLOCK_REGION,
+	FRAMES_CLK_INTERCONNECT,
+	BRAM_CONTENT_FRAMES,
+	23,
+	7,
+	1
+};
+
+static const device_t *const devices[] = {
+	&xc7z020_device,
+	&xc7z100_device
+};
+
+const device_t *fpga_device = &xc7z020_device;
+
+int device_select(u32 idcode)
+{
+	u32 i;
+
+	for (i = 0; i < sizeof(devices) / sizeof(devices[0]); i++) {
+		if ((devices[i]->idcode & DEVICE_IDCODE_MASK) == (idcode & DEVICE_IDCODE_MASK)) {
+			fpga_device = devices[i];
+			return XST_SUCCESS;
+		}
+	}
+
+	return XST_FAILURE;
+}
@@ -0,0 +1,120 @@
+/*
+ * device.h
+ *
+ * Packed description of the devices supported by the run-time. Each device
+ * template provides a device_t descriptor and the device is selected at run
+ * time with the IDCODE read through the PCAP, so the same binary can be used
+ * with all of them. The frame geometry and the FAR encoding depend on the
+ * device family and are described by the device_family_t of the device. Only
+ * the 7 series family is supported.
+ */
+
+#ifndef DEVICE_H_
+#define DEVICE_H_
+
+#include "series7.h"
+#ifdef PCAP_LINUX
+#include "reconfig_pcap_linux.h"
+#else
+#include "xil_types.h"
+#endif
+
+// Maximum size of the supported devices (used to size static arrays)
+#define MAX_ROWS        7 //clock region rows
+#define MAX_COLUMNS     140
+#define MAX_FRAME_WORDS 101
+#define MAX_ROW_FRAMES  4812 // Frames of the widest clock region row
+#define MAX_BRAM_CONTENT_FRAMES BRAM_CONTENT_FRAMES
+
+// Block type definition
+#define CLB_L_TYPE 		0
+#define CLB_M_TYPE 		1
+#define DSP_TYPE 		2
+#define BRAM_TYPE 		3
+#define IOBA_TYPE 		4
+#define IOBB_TYPE 		5
+#define CLK_TYPE 		6
+#define CFG_TYPE		7
+#define GT_TYPE 		8
+#define NONE_TYPE 		9 // The column does not exist in this clock region row
+
+#define DEVICE_NO_BRAM      0xFF       // BRAM major of the columns without BRAM contents
+#define DEVICE_IDCODE_MASK  0x0FFFFFFF // The revision field of the IDCODE is ignored
+
+#define DEVICE_FAR_COLUMN_MASK  0x3FF // Column address field of the FAR
+
+// ID generation
+#define far_base(top, row)  ((top<<22) | (row<<17)) // 7 series
+
+typedef struct {
+	const char *name;
+	u16 frame_words;             // Words of a frame
+	u16 clock_words;             // Words in the middle of the frame that do not belong to any row (clock/ECC)
+	u16 rows_per_clock_region;   // CLB rows of a clock region row
+	u16 group_rows;              // Smallest number of rows that fills a whole number of words ...
+	u16 group_words;             // ... and the words they fill
+	u16 clk_interconnect_frames; // Frames of the CLK and CFG columns that belong to the interconnect
+	u16 bram_content_frames;     // Frames of a BRAM content column
+	u8 far_block_shift;          // Position of the block type in the FAR
+	u8 far_column_shift;         // Position of the column address in the FAR (the minor address is below)
+	u8 fine_grain;               // The LUT layout used by the fine grain reconfiguration is known
+} device_family_t;
+
+extern const device_family_t series7_family;
+
+typedef struct {
+	u8 type;       // Column type (CLB_L_TYPE, CLB_M_TYPE, ...)
+	u8 frames;     // Frames of the column
+	u8 bram_major; // Column address of its BRAM contents or DEVICE_NO_BRAM
+	u8 reserved;
+} device_column_t;
+
+typedef struct {
+	u32 idcode;
+	const char *name;
+	u16 rows;                        // Clock region rows
+	u16 columns;                     // Columns of the widest row
+	const device_column_t *column;   // rows x columns
+	const u16 *frame_offset;         // rows x (columns + 1) frames before each column
+	const u32 *far;                  // FAR of the first frame of each row
+	const device_family_t *family;
+} device_t;
+
+// Device selected
+extern const device_t *fpga_device;
+
+#define DEVICE_COLUMN(y, x)      (fpga_device->column[(y) * fpga_device->columns + (x)])
+#define DEVICE_TYPE(y, x)        (DEVICE_COLUMN(y, x).type)
+#define DEVICE_FRAMES(y, x)      (DEVICE_COLUMN(y, x).frames)
+#define DEVICE_BRAM_MAJOR(y, x)  (DEVICE_COLUMN(y, x).bram_major)
+#define DEVICE_FAR(y)            (fpga_device->far[y])
+
+// Geometry of the frames of the device selected
+#define DEVICE_FAMILY            (fpga_device->family)
+#define FRAME_WORDS              (DEVICE_FAMILY->frame_words)
+#define FRAME_BYTES              (DEVICE_FAMILY->frame_words * 4)
+#define FRAME_CLOCK_WORDS        (DEVICE_FAMILY->clock_words)
+#define CLOCK_REGION_ROWS        (DEVICE_FAMILY->rows_per_clock_region)
+#define CLK_INTERCONNECT_FRAMES  (DEVICE_FAMILY->clk_interconnect_frames)
+// Words of a frame used by a number of rows (a multiple of group_rows)
+#define ROWS_TO_WORDS(rows)      ((rows) / DEVICE_FAMILY->group_rows * DEVICE_FAMILY->group_words)
+
+// Frames of the columns x0 to xf of a clock region row
+#define FRAMES_IN_COLUMNS(y, x0, xf) \
+	(fpga_device->frame_offset[(y) * (fpga_device->columns + 1) + (xf) + 1] - \
+	fpga_device->frame_offset[(y) * (fpga_device->columns + 1) + (x0)])
+
+/****************************************************************************/
+/**
+*
+* Selects the description of the device with an IDCODE. Until a device is
+* selected the first one of the list is used.
+*
+* @param idcode is the IDCODE read from the device
+*
+* @return	XST_SUCCESS else XST_FAILURE (the device is not supported).
+*
+*****************************************************************************/
+int device_select(u32 idcode);
+
+#endif /* DEVICE_H_ */
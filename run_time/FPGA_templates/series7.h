@@ -25,6 +25,7 @@
 #define NUM_FRAME_WORDS                 101 
 #define BYTES_PER_WORD_OF_FRAME				 	4
 #define FRAMES_CLK_INTERCONNECT 		    26
+#define BRAM_CONTENT_FRAMES             128
 
 
 #endif
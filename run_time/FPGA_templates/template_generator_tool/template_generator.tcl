@@ -177,9 +177,35 @@ proc find_resource_type {tile_type} {
   return $resource_type
 }
 
+# Frames of each resource type (see series7.h)
+proc resource_frames {resource} {
+  switch -exact -- $resource {
+    CLB_M -
+    CLB_L {return 36}
+    DSP -
+    BRAM {return 28}
+    CLK -
+    CFG -
+    IOBB {return 30}
+    IOBA {return 42}
+    GT {return 32}
+    default {return 0}
+  }
+}
+
 proc write_run_time_description {file_path resource_list row_order_list first_top_row max_column} {
   set device [get_parts -of_objects [get_projects]]
   set fpga_name [string range $device 2 [expr [string length $device] - 3]]
+  # Name of the device without package and speed grade (e.g. xc7z020)
+  if {![regexp {^[a-z]+[0-9][a-z]+[0-9]+} $device device_name]} {
+    set device_name xc$fpga_name
+  }
+  set device_symbol [string toupper $device_name]
+  # The run-time only describes the frame geometry and FAR encoding of the 
+  # 7 series (UltraScale+ devices are zynquplus, kintexuplus, virtexuplus)
+  if {[string match *uplus [get_property ARCHITECTURE [get_parts $device]]]} {
+    error "UltraScale+ devices are not supported by the run-time"
+  }
   
   set file_c [open ${file_path}/${fpga_name}.c w] 
   
@@ -192,26 +218,18 @@ proc write_run_time_description {file_path resource_list row_order_list first_to
   for {set i 0} {$i < [llength $row_order_list]} {incr i} {
     puts $file_c "#define ROW${i}   ${i}"
   }
-  puts $file_c "// ID generation"
-  puts $file_c "#define block(top, row, type)  ((top<<24) | (row<<16) | (type))"
-  puts $file_c "#define content(yes_no, major)  ((yes_no<<16) | (major))"
   puts $file_c ""
   puts $file_c ""
-  puts $file_c ""
-  
-  puts $file_c "const u32 fpga\[MAX_ROWS\]\[MAX_COLUMNS\]\[2\] = \{"
+  puts $file_c "// Columns of each clock region row (type, frames, BRAM major)"
+  puts $file_c "static const device_column_t columns\[${device_symbol}_ROWS\]\[${device_symbol}_COLUMNS\] = \{"
   
   for {set i 0} {$i < [llength $resource_list]} {incr i} {
     set row_resources_expanded [lindex $resource_list $i]
+    set BRAM_number 0
     puts $file_c "  \{"
-    if {$i < $first_top_row} {
-      set row_half BOTTOM
-    } else {
-      set row_half TOP
-    }
-    set row_position ROW[lindex $row_order_list $i]
-    for {set j 0} {$j < [llength $row_resources_expanded]} {incr j} {
+    for {set j 0} {$j < $max_column} {incr j} {
       set resource [lindex $row_resources_expanded $j]
+      set BRAM_major DEVICE_NO_BRAM
       switch -exact -- $resource {
         CLB_M {
           set resource_name CLB
@@ -228,6 +246,8 @@ proc write_run_time_description {file_path resource_list row_order_list first_to
         BRAM {
           set resource_name BRAM
           set resource_type BRAM_TYPE
+          set BRAM_major $BRAM_number
+          incr BRAM_number
         }
         CLK {
           set resource_name CLK
@@ -250,13 +270,14 @@ proc write_run_time_description {file_path resource_list row_order_list first_to
           set resource_type CFG_TYPE
         }
         default {
-          set resource_name ERROR
-          set resource_type ERROR
+          # The row has less columns than the widest one
+          set resource_name 0
+          set resource_type NONE_TYPE
         }
       }
       
-      puts -nonewline $file_c "    \{block(${row_half}, ${row_position}, ${resource_name}), ${resource_type}\}"
-      if {$j == [expr [llength $row_resources_expanded] - 1]} {
+      puts -nonewline $file_c "    \{${resource_type}, ${resource_name}, ${BRAM_major}, 0\}"
+      if {$j == [expr $max_column - 1]} {
         # We force a new line
         puts $file_c ""
       } else {
@@ -271,25 +292,29 @@ proc write_run_time_description {file_path resource_list row_order_list first_to
   }
   puts $file_c "\};"
   
-  # We write the BRAM content array
-  puts $file_c "const u32 fpga_bram\[MAX_ROWS\]\[MAX_COLUMNS\] = \{"
+  # We write the frames before each column of each row
+  puts $file_c ""
+  puts $file_c "// Frames before each column of a clock region row (the last position"
+  puts $file_c "// contains the frames of the whole row)"
+  puts $file_c "static const u16 frame_offset\[${device_symbol}_ROWS\]\[${device_symbol}_COLUMNS + 1\] = \{"
   for {set i 0} {$i < [llength $resource_list]} {incr i} {
     set row_resources_expanded [lindex $resource_list $i]
-    set BRAM_number 0
+    set frame_offset 0
     puts $file_c "  \{"
-    for {set j 0} {$j < [llength $row_resources_expanded]} {incr j} {
-      set resource [lindex $row_resources_expanded $j]
-      if {$resource == "BRAM"} {
-        puts -nonewline $file_c "   content(BRAM_CONTENT, $BRAM_number)"
-        incr BRAM_number
-      } else {
-        puts -nonewline $file_c "   content(BRAM_NOCONTENT, 0)"
+    for {set j 0} {$j <= $max_column} {incr j} {
+      if {[expr $j % 16] == 0} {
+        puts -nonewline $file_c "    "
       }
-      if {$j == [expr [llength $row_resources_expanded] - 1]} {
-        # We force a new line
+      puts -nonewline $file_c "$frame_offset"
+      if {$j == $max_column} {
         puts $file_c ""
-      } else {
+      } elseif {[expr ($j + 1) % 16] == 0} {
         puts $file_c ","
+      } else {
+        puts -nonewline $file_c ", "
+      }
+      if {$j < [llength $row_resources_expanded]} {
+        incr frame_offset [resource_frames [lindex $row_resources_expanded $j]]
       }
     }
     if {[expr $i + 1] == [llength $resource_list]} {
@@ -300,41 +325,58 @@ proc write_run_time_description {file_path resource_list row_order_list first_to
   }
   puts $file_c "\};"
   
+  # We write the FAR of the first frame of each row
+  puts $file_c ""
+  puts $file_c "// FAR of the first frame of each clock region row"
+  puts $file_c "static const u32 far\[${device_symbol}_ROWS\] = \{"
+  for {set i 0} {$i < [llength $resource_list]} {incr i} {
+    if {$i < $first_top_row} {
+      set row_half BOTTOM
+    } else {
+      set row_half TOP
+    }
+    puts -nonewline $file_c "  far_base(${row_half}, ROW[lindex $row_order_list $i])"
+    if {[expr $i + 1] == [llength $resource_list]} {
+      puts $file_c ""
+    } else {
+      puts $file_c ","
+    }
+  }
+  puts $file_c "\};"
+  
+  # We write the device description
+  puts $file_c ""
+  puts $file_c "const device_t ${device_name}_device = \{"
+  puts $file_c "  ${device_symbol}_IDCODE,"
+  puts $file_c "  \"${device_name}\","
+  puts $file_c "  ${device_symbol}_ROWS,"
+  puts $file_c "  ${device_symbol}_COLUMNS,"
+  puts $file_c "  &columns\[0\]\[0\],"
+  puts $file_c "  &frame_offset\[0\]\[0\],"
+  puts $file_c "  far,"
+  puts $file_c "  &series7_family"
+  puts $file_c "\};"
+  
   flush $file_c
   close $file_c
   
+  # NOTE: the device has to be added to the devices list of device.c and
+  # MAX_ROWS and MAX_COLUMNS of device.h have to be updated if it is bigger
+  # than the other supported devices
   set file_h [open ${file_path}/${fpga_name}.h w] 
-  set header_symbol [string toupper fpga_name]_H
+  set header_symbol ${device_symbol}_H
   puts $file_h "#ifndef $header_symbol"
   puts $file_h "#define $header_symbol"
   puts $file_h ""
   puts $file_h ""
-  puts $file_h "#include \"series7.h\""
-  puts $file_h "#include \"xil_types.h\""
-  puts $file_h ""
-  puts $file_c "// BRAM content definitions"
-  puts $file_c "#define BRAM_CONTENT   1"
-  puts $file_c "#define BRAM_NOCONTENT 0"
-  puts $file_h ""
-  puts $file_c "// Block type definition"
-  puts $file_c "#define CLB_L_TYPE    0"
-  puts $file_c "#define CLB_M_TYPE    1"
-  puts $file_c "#define DSP_TYPE      2"
-  puts $file_c "#define BRAM_TYPE     3"
-  puts $file_c "#define IOBA_TYPE     4"
-  puts $file_c "#define IOBB_TYPE     5"
-  puts $file_c "#define CLK_TYPE      6"
-  puts $file_c "#define CFG_TYPE      7"
-  puts $file_c "#define GT_TYPE       8"
-  puts $file_h ""
-  puts $file_h "#define MAX_ROWS    [llength $row_order_list]"
-  puts $file_h "#define MAX_COLUMNS $max_column"
+  puts $file_h "#include \"device.h\""
   puts $file_h ""
-  puts $file_h "#define PCAP_IDCODE_NUMBER //add the IDCODE of the FPGA here. You can find the IDCODE in the bitstream"
+  puts $file_h "#define ${device_symbol}_ROWS    [llength $row_order_list]"
+  puts $file_h "#define ${device_symbol}_COLUMNS $max_column"
   puts $file_h ""
-  puts $file_h "extern const u32 fpga\[MAX_ROWS\]\[MAX_COLUMNS\]\[2\];"
+  puts $file_h "#define ${device_symbol}_IDCODE 0x00000000 //add the IDCODE of the FPGA here. You can find the IDCODE in the bitstream"
   puts $file_h ""
-  puts $file_h "extern const u32 fpga_bram\[MAX_ROWS\]\[MAX_COLUMNS\];"
+  puts $file_h "extern const device_t ${device_name}_device;"
   puts $file_h ""
   puts $file_h "#endif"
   
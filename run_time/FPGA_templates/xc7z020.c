@@ -1,466 +1,284 @@
 #include "xc7z020.h"
 
+// Clock region definitions
+#define BOTTOM 1
+#define TOP    0
+#define ROW0   0
+#define ROW1   1
 
-// FPGA matrix
-const u32 fpga[MAX_ROWS][MAX_COLUMNS][2] = {
+
+// Columns of each clock region row (type, frames, BRAM major)
+static const device_column_t columns[XC7Z020_ROWS][XC7Z020_COLUMNS] = {
 	{
-		{block(BOTTOM, ROW1, IOB_A), IOBA_TYPE},
-		{block(BOTTOM, ROW1, IOB_B), IOBB_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, DSP), DSP_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, DSP), DSP_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, DSP), DSP_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CLK), CLK_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CFG), CFG_TYPE},
-		{block(BOTTOM, ROW1, CLB),  CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, DSP), DSP_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, DSP), DSP_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, BRAM), BRAM_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW1, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW1, IOB_B), IOBB_TYPE},
-		{block(BOTTOM, ROW1, IOB_A), IOBA_TYPE}
+		{IOBA_TYPE, IOB_A, DEVICE_NO_BRAM, 0},
+		{IOBB_TYPE, IOB_B, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 0, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 1, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 2, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLK_TYPE, CLK, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 3, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CFG_TYPE, CFG, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 4, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 5, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{IOBB_TYPE, IOB_B, DEVICE_NO_BRAM, 0},
+		{IOBA_TYPE, IOB_A, DEVICE_NO_BRAM, 0}
 	},
 	{
-		{block(BOTTOM, ROW0, IOB_A), IOBA_TYPE},
-		{block(BOTTOM, ROW0, IOB_B), IOBB_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, DSP), DSP_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, DSP), DSP_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, DSP), DSP_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CLK), CLK_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CFG), CFG_TYPE},
-		{block(BOTTOM, ROW0, CLB),  CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, DSP), DSP_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, DSP), DSP_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, BRAM), BRAM_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_L_TYPE},
-		{block(BOTTOM, ROW0, CLB), CLB_M_TYPE},
-		{block(BOTTOM, ROW0, IOB_B), IOBB_TYPE},
-		{block(BOTTOM, ROW0, IOB_A), IOBA_TYPE}
+		{IOBA_TYPE, IOB_A, DEVICE_NO_BRAM, 0},
+		{IOBB_TYPE, IOB_B, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 0, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 1, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 2, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLK_TYPE, CLK, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 3, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CFG_TYPE, CFG, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 4, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 5, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{IOBB_TYPE, IOB_B, DEVICE_NO_BRAM, 0},
+		{IOBA_TYPE, IOB_A, DEVICE_NO_BRAM, 0}
 	},
 	{
-		{block(TOP, ROW0, IOB_A), IOBA_TYPE},
-		{block(TOP, ROW0, IOB_B), IOBB_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, BRAM), BRAM_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, DSP), DSP_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, DSP), DSP_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, BRAM), BRAM_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, BRAM), BRAM_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, DSP), DSP_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, CLK), CLK_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, BRAM), BRAM_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, CFG), CFG_TYPE},
-		{block(TOP, ROW0, CLB),  CLB_L_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, BRAM), BRAM_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, DSP), DSP_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, DSP), DSP_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, BRAM), BRAM_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, CLB), CLB_L_TYPE},
-		{block(TOP, ROW0, CLB), CLB_M_TYPE},
-		{block(TOP, ROW0, IOB_B), IOBB_TYPE},
-		{block(TOP, ROW0, IOB_A), IOBA_TYPE}
+		{IOBA_TYPE, IOB_A, DEVICE_NO_BRAM, 0},
+		{IOBB_TYPE, IOB_B, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 0, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 1, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 2, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLK_TYPE, CLK, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 3, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CFG_TYPE, CFG, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 4, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{DSP_TYPE, DSP, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{BRAM_TYPE, BRAM, 5, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_L_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{CLB_M_TYPE, CLB, DEVICE_NO_BRAM, 0},
+		{IOBB_TYPE, IOB_B, DEVICE_NO_BRAM, 0},
+		{IOBA_TYPE, IOB_A, DEVICE_NO_BRAM, 0}
 	}
 };
 
-// FPGA bram matrix
-const u32 fpga_bram[MAX_ROWS][MAX_COLUMNS] = {
+// Frames before each column of a clock region row (the last position
+// contains the frames of the whole row)
+static const u16 frame_offset[XC7Z020_ROWS][XC7Z020_COLUMNS + 1] = {
 	{
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 1),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 2),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 3),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 4),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 5),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0)
+		0, 42, 72, 108, 144, 180, 216, 244, 280, 316, 344, 380, 416, 452, 488, 516,
+		552, 588, 616, 652, 688, 724, 760, 788, 824, 860, 888, 924, 960, 996, 1032, 1068,
+		1104, 1140, 1170, 1206, 1242, 1270, 1306, 1342, 1378, 1414, 1450, 1486, 1522, 1558, 1594, 1630,
+		1666, 1702, 1738, 1768, 1804, 1840, 1876, 1912, 1948, 1976, 2012, 2048, 2076, 2112, 2148, 2184,
+		2220, 2248, 2284, 2320, 2348, 2384, 2420, 2456, 2492, 2522, 2564
 	},
 	{
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 1),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 2),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 3),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 4),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 5),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0)
+		0, 42, 72, 108, 144, 180, 216, 244, 280, 316, 344, 380, 416, 452, 488, 516,
+		552, 588, 616, 652, 688, 724, 760, 788, 824, 860, 888, 924, 960, 996, 1032, 1068,
+		1104, 1140, 1170, 1206, 1242, 1270, 1306, 1342, 1378, 1414, 1450, 1486, 1522, 1558, 1594, 1630,
+		1666, 1702, 1738, 1768, 1804, 1840, 1876, 1912, 1948, 1976, 2012, 2048, 2076, 2112, 2148, 2184,
+		2220, 2248, 2284, 2320, 2348, 2384, 2420, 2456, 2492, 2522, 2564
 	},
 	{
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 1),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 2),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 3),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 4),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_CONTENT, 5),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0),
-		content(BRAM_NOCONTENT, 0)
+		0, 42, 72, 108, 144, 180, 216, 244, 280, 316, 344, 380, 416, 452, 488, 516,
+		552, 588, 616, 652, 688, 724, 760, 788, 824, 860, 888, 924, 960, 996, 1032, 1068,
+		1104, 1140, 1170, 1206, 1242, 1270, 1306, 1342, 1378, 1414, 1450, 1486, 1522, 1558, 1594, 1630,
+		1666, 1702, 1738, 1768, 1804, 1840, 1876, 1912, 1948, 1976, 2012, 2048, 2076, 2112, 2148, 2184,
+		2220, 2248, 2284, 2320, 2348, 2384, 2420, 2456, 2492, 2522, 2564
 	}
-};
\ No newline at end of file
+};
+
+// FAR of the first frame of each clock region row
+static const u32 far[XC7Z020_ROWS] = {
+	far_base(BOTTOM, ROW1),
+	far_base(BOTTOM, ROW0),
+	far_base(TOP, ROW0)
+};
+
+const device_t xc7z020_device = {
+	XC7Z020_IDCODE,
+	"xc7z020",
+	XC7Z020_ROWS,
+	XC7Z020_COLUMNS,
+	&columns[0][0],
+	&frame_offset[0][0],
+	far,
+	&series7_family
+};
@@ -1,12 +1,17 @@
 #include <stdint.h> 
 #include "IMPRESS_reconfiguration.h"
 #include "series7.h"
-#include "xc7z020.h"
+#include "device.h"
 #include "reconfig_pcap.h"
 #include "xparameters.h"
 #include <xstatus.h>
 #include "xtime_l.h"
+#include "xil_printf.h"
 #include <stdio.h>
+#include <string.h>
+#if FINE_GRAIN && FINE_GRAIN_INTERRUPT
+#include "xscugic.h"
+#endif
 
 #if FINE_GRAIN
 #define SEARCH_IF_FINE_GRAIN_VALUE_HAS_CHANGED		0
@@ -20,6 +25,12 @@ please set ICAP_CTRL_BASEADDR manually
 #endif
 
 #define ICAP ((volatile unsigned int *) ICAP_CTRL_BASEADDR)
+#define ICAP_IRQ_REG        14
+#define ICAP_IRQ_ACK        0x1 // Interrupt while a new XFAR can be written
+#define ICAP_IRQ_READY      0x2 // Interrupt when the RE is idle
+#if FINE_GRAIN_INTERRUPT
+#define ICAP_INTR_ID        XPAR_FABRIC_FINE_GRAIN_RE_0_IRQ_INTR
+#endif
 #endif
 
 #define PCAP_ID 						                XPAR_XDCFG_0_DEVICE_ID
@@ -42,6 +53,26 @@ please set ICAP_CTRL_BASEADDR manually
 #define WORDS_PER_MUX                       13
 #define WORDS_PER_FU                        10
 #define LUTS_PER_CLB						            4
+#define XFAR_FRAME_ADDR_MASK                0x03FFFFFF
+#define XFAR_NUM_FRAMES(xfar)               (((xfar) >> 26) & 0x7)
+#define XFAR_ELEMENT_TYPE(xfar)             (((xfar) >> 30) & 0x3)
+#define MAX_WORDS_PER_FINE_GRAIN_FRAME      13
+#define FINE_GRAIN_QUEUE_SIZE               (MAX_COLUMNS_CONSTANTS + MAX_COLUMNS_MUX + MAX_COLUMNS_FU)
+#define FRAME_SLOT_MAP_SIZE                 (2 * FINE_GRAIN_QUEUE_SIZE + 1) // Open addressing, load factor below 0.5
+#define FRAME_SLOT_EMPTY                    -1
+#define FRAME_SLOT_DELETED                  -2 // Released entry, the probe sequence continues after it
+#define NUM_FU_FUNCTIONS                    18 // Predefined FU functions (FU_functions_t)
+#define FU_FUNCTION_SLOTS                   32 // FU cfg values (5 bits) that select an RE memory template
+#define RE_MEMORY_WORDS                     (256 + FU_FUNCTION_SLOTS * 8) // Constant, mux and FU templates
+#define FINE_GRAIN_FRAME_WORDS              101 // The fine-grain RE only supports 7 series frames
+#define FINE_GRAIN_CLOCK_WORD               50
+#define FINE_GRAIN_PCAP_MAX_FRAMES          (MAX_COLUMNS_CONSTANTS + MAX_COLUMNS_MUX + 2 * MAX_COLUMNS_FU + FINE_GRAIN_QUEUE_SIZE) // Including a padding frame per run
+// Initial cost estimates of the fine-grain routes. The frame costs are then measured.
+#define FINE_GRAIN_RE_FRAME_US              2
+#define FINE_GRAIN_PCAP_FRAME_US            4
+#define FINE_GRAIN_PCAP_RUN_US              10 // FAR and FDRI header of each run of consecutive frames
+#define FINE_GRAIN_PCAP_COMMIT_US           20 // Synchronization and desynchronization
+#define US_TO_TICKS(us)                     ((us) * (COUNTS_PER_SECOND / 1000000))
 
 typedef struct {
   uint32_t frame_address;
@@ -61,10 +92,52 @@ typedef struct {
   uint32_t value[WORDS_PER_FU];
 } frame_FU_t;
 
+typedef struct {
+  uint32_t xfar;
+  uint32_t *value;
+  int words;
+} fine_grain_frame_t;
+
+typedef struct {
+  uint32_t frame_address;
+  int16_t slot;
+  uint8_t element_type;
+} frame_slot_entry_t;
+
+typedef struct {
+  int registered;
+  uint32_t lut[2];
+  int slot; // RE memory template that holds the function (-1 if it is not loaded)
+} FU_user_function_t;
+
+#if FINE_GRAIN_SNAPSHOTS
+typedef struct {
+  char name[MAX_CHARS_PER_SNAPSHOT];
+  frame_constant_t constant_frames[MAX_COLUMNS_CONSTANTS];
+  frame_mux_t mux_frames[MAX_COLUMNS_MUX];
+  frame_FU_t FU_frames[MAX_COLUMNS_FU];
+  constant_t constants_definition[MAX_FINE_GRAIN_PARTITIONS][MAX_CONSTANTS];
+  mux_t mux_definition[MAX_FINE_GRAIN_PARTITIONS][MAX_MUXES];
+  FU_t FU_definition[MAX_FINE_GRAIN_PARTITIONS][MAX_FU];
+} fine_grain_snapshot_t;
+#endif
+
 
 /* Function declarations*/
 static void update_partition_location_info(virtual_architecture_t *virtual_architecture, int x, int y);
 static int init_PCAP();
+static int write_partition_PBS(int element_info, pblock *pblock_1, u8 stacked_modules);
+#if PBS_CACHE_OCM
+static u32 *merge_addr(pblock *pblock_1, u8 stacked_modules);
+#endif
+#if PBS_PREFETCH
+static void record_element_transition(virtual_architecture_t *virtual_architecture, int x, int y, int element_info);
+#endif
+#if PARTITION_ALLOCATOR
+static void get_element_origin(int element_info, int *origin_x, int *origin_y);
+static int is_position_compatible(int element_info, int origin_x, int origin_y, int position_x, int position_y);
+static int is_position_free(virtual_architecture_t *virtual_architecture, int position_x, int position_y, int width, int height);
+#endif
 #if FINE_GRAIN
 static void init_num_constant_columns_elements();
 static void init_num_mux_columns_elements();
@@ -73,9 +146,10 @@ static void init_constant_frames();
 static void init_mux_frames();
 static void init_FU_frames();
 static uint32_t obtain_frame_address_of_CLB_column(virtual_architecture_t *virtual_architecture, int x, int y, int clock_row_number, int column_number);
-static void change_constant_frame_address(uint32_t frame_address_position, int first_bit, int last_bit, int previous_bits_sent, uint32_t *value);
-static void change_mux_frame_address(uint32_t frame_address_position, int first_LUT, int last_LUT, int value, int LUT_position, int num_inputs);
-static void change_FU_frame_address(uint32_t frame_address_position, int first_block, int last_block, int value);
+static void calculate_constant_scatter_plan(fine_grain_layout_t *element, int constant_number, int num_segments, const int *frame_address_position, const int *first_bit_in_frame, const int *last_bit_in_frame);
+static int calculate_mux_encoding_table(fine_grain_layout_t *element, int mux_number, int num_segments, int num_inputs, const int *frame_address_position, const int *first_LUT_in_frame, const int *last_LUT_in_frame, const int *LUT_position_in_frame);
+static int calculate_FU_segments(fine_grain_layout_t *element, int FU_number, int frame_address_position, int first_block, int last_block);
+static uint32_t get_mux_LUT_select(int value, int LUT_position);
 static int obtain_CLB_minor_column(int row, int column, int num_slice);
 static int is_column_CLB_type(int row, int column);
 static void reset_fine_grain_elements(virtual_architecture_t *virtual_architecture, int x, int y);
@@ -87,18 +161,54 @@ static uint16_t get_PBS_2_bits(int bits);
 static void load_constant_PBS();
 static void load_mux_PBS();
 static void load_FU();
+static void write_FU_function(int slot, uint32_t stage1_LUT, uint32_t stage2_LUT);
+static int get_FU_function_slot(int function);
+static int is_FU_slot_in_use(int slot);
 static void load_fine_grain_PBS();
 static uint32_t obtain_XFAR(uint32_t element_type, uint32_t num_frames, uint32_t frame_address);
 static int LUTs_in_mux(int data_width, int num_inputs);
 static void enable_ICAP();
 static int update_partition_fine_grain_info(virtual_architecture_t *virtual_architecture, int x, int y);
+static void release_partition_fine_grain(virtual_architecture_t *virtual_architecture, int x, int y);
 static void reconfigure_constants();
 static void reconfigure_muxes();
 static void reconfigure_FU();
+static void queue_fine_grain_frame(uint32_t element_type, uint32_t num_frames, uint32_t frame_address, uint32_t *value, int words);
+static void init_frame_slot_map();
+static int get_frame_slot(uint32_t element_type, uint32_t frame_address);
+static int acquire_frame_slot(fine_grain_layout_t *layout, uint32_t element_type, uint32_t frame_address);
+static void release_frame_slot(uint32_t element_type, int slot);
+static void release_layout_frame_slots(fine_grain_layout_t *layout);
+static void set_constant_frame_dirty(int slot);
+static void set_mux_frame_dirty(int slot);
+static void set_FU_frame_dirty(int slot);
+static int send_fine_grain_queue();
+static void finish_fine_grain_commit();
+#if !FINE_GRAIN_INTERRUPT
+static void check_fine_grain_commit_timing();
+#endif
+#if FINE_GRAIN_PCAP_ROUTING
+static void init_fine_grain_routing();
+static uint32_t count_fine_grain_queue_frames();
+static int count_fine_grain_PCAP_runs();
+static int write_fine_grain_queue_PCAP();
+static void compose_fine_grain_frame(uint32_t *frame, uint32_t element_type, const uint32_t *cfg, int frame_number);
+static void update_fine_grain_route_statistics(int route, uint32_t frames, int num_runs, int timed, XTime elapsed);
+#endif
+#if FINE_GRAIN_SNAPSHOTS
+static fine_grain_snapshot_t *find_fine_grain_snapshot(const char *name);
+#endif
 #endif
 
 /*Global variables*/
 static XDcfg xCAP_component;
+#if PBS_PREFETCH
+// Number of times that each element (second index) has been reconfigured
+// after another element (first index) in any partition
+static uint16_t element_transitions[NUM_ELEMENTS][NUM_ELEMENTS];
+// The element predicted after each element has already been prefetched
+static uint8_t prediction_prefetched[NUM_ELEMENTS];
+#endif
 #if FINE_GRAIN
 static frame_constant_t constant_t_frames[MAX_COLUMNS_CONSTANTS]; //__attribute__((section(".OCM.data")));
 static int8_t constant_frames_flags[MAX_COLUMNS_CONSTANTS];
@@ -106,12 +216,73 @@ static frame_mux_t mux_t_frames[MAX_COLUMNS_MUX];
 static int8_t mux_frames_flags[MAX_COLUMNS_MUX];
 static frame_FU_t  FU_t_frames[MAX_COLUMNS_FU];
 static int8_t FU_frames_flags[MAX_COLUMNS_FU];
+// Frame address to slot of the *_t_frames arrays
+static frame_slot_entry_t frame_slot_map[FRAME_SLOT_MAP_SIZE];
+static int num_constant_frames, num_mux_frames, num_FU_frames;
+// Layouts that reference each slot and slots released for reuse
+static uint8_t constant_frames_refs[MAX_COLUMNS_CONSTANTS];
+static uint8_t mux_frames_refs[MAX_COLUMNS_MUX];
+static uint8_t FU_frames_refs[MAX_COLUMNS_FU];
+static uint16_t constant_free_frames[MAX_COLUMNS_CONSTANTS];
+static uint16_t mux_free_frames[MAX_COLUMNS_MUX];
+static uint16_t FU_free_frames[MAX_COLUMNS_FU];
+static int num_constant_free_frames, num_mux_free_frames, num_FU_free_frames;
+// Slots updated since the last commit
+static uint16_t constant_dirty_frames[MAX_COLUMNS_CONSTANTS];
+static uint16_t mux_dirty_frames[MAX_COLUMNS_MUX];
+static uint16_t FU_dirty_frames[MAX_COLUMNS_FU];
+static int num_constant_dirty_frames, num_mux_dirty_frames, num_FU_dirty_frames;
+// Fine-grain state of the partitions that hold fine-grain elements
+static fine_grain_layout_t fine_grain_layouts[MAX_FINE_GRAIN_PARTITIONS];
+static int num_fine_grain_layouts;
+static uint8_t free_fine_grain_layouts[MAX_FINE_GRAIN_PARTITIONS]; // Released layouts, reused before taking a new one
+static int num_free_fine_grain_layouts;
+static fine_grain_frame_t fine_grain_queue[FINE_GRAIN_QUEUE_SIZE];
+static int fine_grain_queue_length;
+// Frames of the commit in flight. The frame shadow arrays can be changed 
+// for the next commit while these words are written.
+static uint32_t fine_grain_inflight_words[FINE_GRAIN_QUEUE_SIZE][MAX_WORDS_PER_FINE_GRAIN_FRAME];
+static int fine_grain_queue_sent;
+static uint32_t fine_grain_commits_started;
+static volatile uint32_t fine_grain_commits_completed; // Written by the ISR
+static fine_grain_commit_callback_t fine_grain_commit_callback;
+static void *fine_grain_commit_callback_ref;
+#if FINE_GRAIN_SNAPSHOTS
+static fine_grain_snapshot_t fine_grain_snapshots[FINE_GRAIN_SNAPSHOTS];
+#endif
+static FU_user_function_t FU_user_functions[MAX_FU_USER_FUNCTIONS];
+// Function loaded in each RE memory template (-1 if the template is free)
+static int FU_slot_function[FU_FUNCTION_SLOTS];
+static uint32_t FU_slot_last_use[FU_FUNCTION_SLOTS];
+static uint32_t FU_slot_uses;
+#if FINE_GRAIN_PCAP_ROUTING
+// Copy of the RE memory used to compose the frames written through the PCAP
+static uint32_t RE_memory[RE_MEMORY_WORDS];
+static int RE_memory_outdated;
+static uint32_t fine_grain_PCAP_frames[FINE_GRAIN_PCAP_MAX_FRAMES][FINE_GRAIN_FRAME_WORDS];
+static u32 fine_grain_PCAP_far[FINE_GRAIN_QUEUE_SIZE];
+static u32 fine_grain_PCAP_num_frames[FINE_GRAIN_QUEUE_SIZE];
+static fine_grain_route_statistics_t fine_grain_route_statistics;
+static XTime fine_grain_commit_start;
+static uint32_t fine_grain_commit_frames;
+static int fine_grain_commit_timed; // Cleared if the RE may have waited for the CPU during the commit
+#endif
 #endif
 /* Function definitions*/
 void init_virtual_architecture() {
   init_PCAP();
+  #if PBS_STORE
+  PBS_store_init();
+  #endif
+  #if PBS_CACHE
+  PBS_cache_init();
+  #endif
+  #if PBS_PREFETCH
+  memset(prediction_prefetched, 0, sizeof(prediction_prefetched));
+  #endif
   #if FINE_GRAIN
   find_number_of_fine_grain_blocks();
+  init_frame_slot_map();
   init_constant_frames();
   init_mux_frames();
   init_FU_frames();
@@ -119,16 +290,32 @@ void init_virtual_architecture() {
   init_num_mux_columns_elements();
   init_num_FU_columns_elements();
   load_fine_grain_PBS();
+  #if FINE_GRAIN_PCAP_ROUTING
+  init_fine_grain_routing();
+  #endif
   #endif
 }
 
 static int init_PCAP() {
   int status;
   
+  u32 idcode;
+  
   status = PCAP_Initialize(&xCAP_component, PCAP_ID);
   if (status != XST_SUCCESS) {
     return XST_FAILURE;
   }
+
+  // Select the description of the device where the run-time is executed
+  status = PCAP_read_IDCODE(&xCAP_component, &idcode);
+  if (status != XST_SUCCESS) {
+    xil_printf("ERROR: IDCODE not read\n");
+    return XST_FAILURE;
+  }
+  if (device_select(idcode) != XST_SUCCESS) {
+    xil_printf("ERROR: device not supported (IDCODE 0x%08x)\n", idcode);
+    return XST_FAILURE;
+  }
   
   return XST_SUCCESS;
 }
@@ -136,6 +323,10 @@ static int init_PCAP() {
 
 
 static void enable_PCAP() {
+  #if FINE_GRAIN
+    // The ICAP must not be released while a fine-grain commit is in flight
+    wait_fine_grain_commit(fine_grain_commits_started);
+  #endif
   XDcfg_SelectPcapInterface(&xCAP_component);
 }
 
@@ -146,22 +337,30 @@ int change_partition_element(virtual_architecture_t *virtual_architecture, int x
   int status;
   pblock pblock_1;
   
-  if (virtual_architecture->partition[x][y].element.element_info == &elements[element_info]) {
-    return XST_SUCCESS;
-  } else if (element_info == -1) {
+  if (element_info == -1) {
     //We can use this command to invalidate a partition. This can be used for example when other partition overwrite in the location of this partition
+    #if FINE_GRAIN
+      release_partition_fine_grain(virtual_architecture, x, y);
+    #endif
     virtual_architecture->partition[x][y].element.element_info = NULL;
     return XST_SUCCESS;
+  } else if (virtual_architecture->partition[x][y].element.element_info == &elements[element_info]) {
+    return XST_SUCCESS;
   }
   
+  #if PBS_PREFETCH
+    record_element_transition(virtual_architecture, x, y, element_info);
+  #endif
   virtual_architecture->partition[x][y].element.element_info = &elements[element_info];
   
-  char *filename = virtual_architecture->partition[x][y].element.element_info->PBS_name;
-  
   update_partition_location_info(virtual_architecture, x, y);
   
   #if FINE_GRAIN
-    update_partition_fine_grain_info(virtual_architecture, x, y);
+    // The PBS is not written if the fine-grain components cannot be placed
+    if (update_partition_fine_grain_info(virtual_architecture, x, y) != XST_SUCCESS) {
+      virtual_architecture->partition[x][y].element.element_info = NULL;
+      return XST_FAILURE;
+    }
     reset_fine_grain_elements(virtual_architecture, x, y);
   #endif
   
@@ -170,8 +369,7 @@ int change_partition_element(virtual_architecture_t *virtual_architecture, int x
   pblock_1.Xf = virtual_architecture->partition[x][y].position[X_POS] + virtual_architecture->partition[x][y].element.element_info->size[WIDTH_POS] - 1;
   pblock_1.Yf = virtual_architecture->partition[x][y].position[Y_POS] + virtual_architecture->partition[x][y].element.element_info->size[HEIGHT_POS] - 1;
   
-  enable_PCAP();
-  status = write_subclock_region_PBS(&xCAP_component, (u32*) INITIAL_ADDR_RAM, filename, &pblock_1, 1, 0, 0);
+  status = write_partition_PBS(element_info, &pblock_1, 0);
   
   return status;
 }
@@ -186,18 +384,26 @@ int change_partition_element_stacked_modules(virtual_architecture_t *virtual_arc
 	  return XST_SUCCESS;
   } else if (element_info == -1) {
 	  //We can use this command to invalidate a partition. This can be used for example when other partition overwrite in the location of this partition
+	  #if FINE_GRAIN
+	    release_partition_fine_grain(virtual_architecture, x, y);
+	  #endif
 	  virtual_architecture->partition[x][y].element.element_info = NULL;
 	  return XST_SUCCESS;
   }
 
+  #if PBS_PREFETCH
+    record_element_transition(virtual_architecture, x, y, element_info);
+  #endif
   virtual_architecture->partition[x][y].element.element_info = &elements[element_info];
 
-  char *filename = virtual_architecture->partition[x][y].element.element_info->PBS_name;
-
   update_partition_location_info(virtual_architecture, x, y);
 
   #if FINE_GRAIN
-    update_partition_fine_grain_info(virtual_architecture, x, y);
+    // The PBS is not written if the fine-grain components cannot be placed
+    if (update_partition_fine_grain_info(virtual_architecture, x, y) != XST_SUCCESS) {
+      virtual_architecture->partition[x][y].element.element_info = NULL;
+      return XST_FAILURE;
+    }
     reset_fine_grain_elements(virtual_architecture, x, y);
   #endif
 
@@ -206,7 +412,6 @@ int change_partition_element_stacked_modules(virtual_architecture_t *virtual_arc
   pblock_1.Xf = virtual_architecture->partition[x][y].position[X_POS] + virtual_architecture->partition[x][y].element.element_info->size[WIDTH_POS] - 1;
   pblock_1.Yf = virtual_architecture->partition[x][y].position[Y_POS] + virtual_architecture->partition[x][y].element.element_info->size[HEIGHT_POS] - 1;
 
-  enable_PCAP();
   if (first_module == 1 && last_module == 0) {
 	  stacked_modules = 1;
   } else if (first_module == 0 && last_module == 0) {
@@ -216,28 +421,315 @@ int change_partition_element_stacked_modules(virtual_architecture_t *virtual_arc
   } else {
 	  stacked_modules = 0;
   }
-  status = write_subclock_region_PBS(&xCAP_component, (u32*) INITIAL_ADDR_RAM, filename, &pblock_1, 1, 0, stacked_modules);
+  status = write_partition_PBS(element_info, &pblock_1, stacked_modules);
 
   return status;
 }
 
-void change_partition_position(virtual_architecture_t *virtual_architecture, int x, int y, int position_x, int position_y) {
+static int write_partition_PBS(int element_info, pblock *pblock_1, u8 stacked_modules) {
+  #if INITIAL_ADDR_RAM_SIZE
+    // The readback of the region must fit in the RAM reserved from INITIAL_ADDR_RAM
+    if (stacked_modules <= 1 && PCAP_staging_bytes(pblock_1, 1) > INITIAL_ADDR_RAM_SIZE) {
+      return XST_FAILURE;
+    }
+  #endif
+  #if PBS_STORE
+    // The TOC of the store describes where the PBS can be placed
+    if (PBS_store_check_geometry(element_info, pblock_1) != XST_SUCCESS) {
+      return XST_FAILURE;
+    }
+  #endif
+  #if PBS_CACHE
+    int status;
+    u32 *PBS_addr;
+    UINTPTR PBS_last_addr;
+
+    status = PBS_cache_get(element_info, elements[element_info].PBS_name, &PBS_addr, &PBS_last_addr);
+    if (status != XST_SUCCESS) {
+      return XST_FAILURE;
+    }
+    enable_PCAP();
+    #if PBS_CACHE_OCM
+      return write_subclock_region_PBS_from_RAM(&xCAP_component, merge_addr(pblock_1, stacked_modules), PBS_addr, PBS_last_addr, pblock_1, 1, 0, stacked_modules);
+    #else
+      return write_subclock_region_PBS_from_RAM(&xCAP_component, (u32*) INITIAL_ADDR_RAM, PBS_addr, PBS_last_addr, pblock_1, 1, 0, stacked_modules);
+    #endif
+  #elif PBS_STORE
+    UINTPTR PBS_last_addr;
+
+    PBS_last_addr = PBS_store_load(element_info, (u32*) PBS_STORE_ADDR_RAM, PBS_STORE_MAX_SIZE);
+    if (PBS_last_addr == 0) {
+      return XST_FAILURE;
+    }
+    enable_PCAP();
+    return write_subclock_region_PBS_from_RAM(&xCAP_component, (u32*) INITIAL_ADDR_RAM, (u32*) PBS_STORE_ADDR_RAM, PBS_last_addr, pblock_1, 1, 0, stacked_modules);
+  #else
+    enable_PCAP();
+    return write_subclock_region_PBS(&xCAP_component, (u32*) INITIAL_ADDR_RAM, elements[element_info].PBS_name, pblock_1, 1, 0, stacked_modules);
+  #endif
+}
+
+#if PBS_CACHE_OCM
+/*
+ * Selects where the region is read back and merged with the PBS. Small regions
+ * use the OCM scratch. Stacked modules continue the merge started by the
+ * previous module, so they always use the DDR.
+ */
+static u32 *merge_addr(pblock *pblock_1, u8 stacked_modules) {
+  u32 *addr;
+
+  if (stacked_modules != 0) {
+    return (u32*) INITIAL_ADDR_RAM;
+  }
+  addr = PBS_cache_OCM_scratch(PCAP_staging_bytes(pblock_1, 1));
+  if (addr == NULL) {
+    return (u32*) INITIAL_ADDR_RAM;
+  }
+  return addr;
+}
+#endif
+
+#if PBS_PREFETCH
+static void record_element_transition(virtual_architecture_t *virtual_architecture, int x, int y, int element_info) {
+  int previous_element, i;
+  uint16_t *transitions;
+
+  // The prediction that follows the new element can be prefetched again
+  prediction_prefetched[element_info] = 0;
+  if (virtual_architecture->partition[x][y].element.element_info == NULL) {
+    return;
+  }
+  previous_element = virtual_architecture->partition[x][y].element.element_info - elements;
+  transitions = element_transitions[previous_element];
+  // When a counter saturates all the counters of the row are halved, so old
+  // behaviour is progressively forgotten and the ratios are kept
+  if (transitions[element_info] == UINT16_MAX) {
+    for (i = 0; i < NUM_ELEMENTS; i++) {
+      transitions[i] >>= 1;
+    }
+  }
+  transitions[element_info]++;
+}
+
+int prefetch_partition_PBS(virtual_architecture_t *virtual_architecture) {
+  int x, y, i, current_element, predicted_element, best_element, best_current_element;
+  uint16_t best_count;
+  uint16_t *transitions;
+  u8 predicted[NUM_ELEMENTS];
+
+  memset(predicted, 0, sizeof(predicted));
+  best_element = -1;
+  best_current_element = -1;
+  best_count = 0;
+  for (x = 0; x < MAX_WIDTH_VIRTUAL_ARCHITECTURE; x++) {
+    for (y = 0; y < MAX_HEIGHT_VIRTUAL_ARCHITECTURE; y++) {
+      if (virtual_architecture->partition[x][y].element.element_info == NULL) {
+        continue;
+      }
+      current_element = virtual_architecture->partition[x][y].element.element_info - elements;
+      transitions = element_transitions[current_element];
+      predicted_element = -1;
+      for (i = 0; i < NUM_ELEMENTS; i++) {
+        if (transitions[i] != 0 && (predicted_element == -1 || transitions[i] > transitions[predicted_element])) {
+          predicted_element = i;
+        }
+      }
+      if (predicted_element == -1) {
+        continue;
+      }
+      predicted[predicted_element] = 1;
+      if (!prediction_prefetched[current_element] && !PBS_cache_contains(predicted_element) && transitions[predicted_element] > best_count) {
+        best_count = transitions[predicted_element];
+        best_element = predicted_element;
+        best_current_element = current_element;
+      }
+    }
+  }
+
+  if (best_element == -1) {
+    return 0;
+  }
+  // The prediction is not prefetched again even if the PBS is evicted before
+  // it is used, so the SD card is not accessed endlessly
+  prediction_prefetched[best_current_element] = 1;
+  return PBS_cache_prefetch(best_element, elements[best_element].PBS_name, predicted);
+}
+#endif
+
+#if PARTITION_ALLOCATOR
+int allocate_partition(virtual_architecture_t *virtual_architecture, int element_info, int *x, int *y) {
+  int i, j, free_x, free_y, origin_x, origin_y, position_x, position_y, width, height;
+
+  if (element_info < 0 || element_info >= NUM_ELEMENTS) {
+    return XST_FAILURE;
+  }
+
+  // Any partition that is not holding or reserved for an element can be used
+  free_x = -1;
+  free_y = -1;
+  for (i = 0; i < MAX_WIDTH_VIRTUAL_ARCHITECTURE && free_x == -1; i++) {
+    for (j = 0; j < MAX_HEIGHT_VIRTUAL_ARCHITECTURE; j++) {
+      if (virtual_architecture->partition[i][j].allocated_element == NULL && virtual_architecture->partition[i][j].element.element_info == NULL) {
+        free_x = i;
+        free_y = j;
+        break;
+      }
+    }
+  }
+  if (free_x == -1) {
+    return XST_FAILURE;
+  }
+
+  get_element_origin(element_info, &origin_x, &origin_y);
+  width = elements[element_info].size[WIDTH_POS];
+  height = elements[element_info].size[HEIGHT_POS];
+
+  // Bottom-left placement. The PBS can only be moved a whole number of clock 
+  // region rows, so the first row tried has the same offset inside its clock 
+  // region row as the origin
+  position_y = PARTITION_ALLOCATOR_Y0 + ((origin_y - PARTITION_ALLOCATOR_Y0) % CLOCK_REGION_ROWS + CLOCK_REGION_ROWS) % CLOCK_REGION_ROWS;
+  for (; position_y + height - 1 <= PARTITION_ALLOCATOR_YF; position_y += CLOCK_REGION_ROWS) {
+    for (position_x = PARTITION_ALLOCATOR_X0; position_x + width - 1 <= PARTITION_ALLOCATOR_XF; position_x++) {
+      if (is_position_compatible(element_info, origin_x, origin_y, position_x, position_y) && 
+          is_position_free(virtual_architecture, position_x, position_y, width, height)) {
+        if (change_partition_position(virtual_architecture, free_x, free_y, position_x, position_y) != XST_SUCCESS) {
+          return XST_FAILURE;
+        }
+        virtual_architecture->partition[free_x][free_y].allocated_element = &elements[element_info];
+        *x = free_x;
+        *y = free_y;
+        return XST_SUCCESS;
+      }
+    }
+  }
+  return XST_FAILURE;
+}
+
+int release_partition(virtual_architecture_t *virtual_architecture, int x, int y) {
+  if (x < 0 || x >= MAX_WIDTH_VIRTUAL_ARCHITECTURE || y < 0 || y >= MAX_HEIGHT_VIRTUAL_ARCHITECTURE) {
+    return XST_FAILURE;
+  }
+  if (virtual_architecture->partition[x][y].allocated_element == NULL) {
+    return XST_FAILURE;
+  }
+  virtual_architecture->partition[x][y].allocated_element = NULL;
+  // The fine-grain layout and its frame slots go back to the free lists so the
+  // next element allocated can use them
+  #if FINE_GRAIN
+    release_partition_fine_grain(virtual_architecture, x, y);
+  #endif
+  virtual_architecture->partition[x][y].element.element_info = NULL;
+  return XST_SUCCESS;
+}
+
+static void get_element_origin(int element_info, int *origin_x, int *origin_y) {
+  #if PBS_STORE
+    const PBS_store_entry_t *entry;
+
+    // The TOC of the store records where the PBS was extracted
+    entry = PBS_store_get_entry(element_info);
+    if (entry != NULL && entry->num_rows != 0) {
+      *origin_x = entry->X0;
+      *origin_y = entry->Y0;
+      return;
+    }
+  #endif
+  *origin_x = elements[element_info].origin[X_POS];
+  *origin_y = elements[element_info].origin[Y_POS];
+}
+
+static int is_position_compatible(int element_info, int origin_x, int origin_y, int position_x, int position_y) {
+  int i, row, width, height, first_row, last_row, origin_row;
+
+  width = elements[element_info].size[WIDTH_POS];
+  height = elements[element_info].size[HEIGHT_POS];
+  first_row = position_y / CLOCK_REGION_ROWS;
+  last_row = (position_y + height - 1) / CLOCK_REGION_ROWS;
+  origin_row = origin_y / CLOCK_REGION_ROWS;
+
+  if (position_y % CLOCK_REGION_ROWS != origin_y % CLOCK_REGION_ROWS) {
+    return 0;
+  }
+  if (position_x + width > fpga_device->columns || origin_x + width > fpga_device->columns) {
+    return 0;
+  }
+  if (last_row >= fpga_device->rows || origin_row + last_row - first_row >= fpga_device->rows) {
+    return 0;
+  }
+  // Each column of each clock region row has to be of the same type as in the origin
+  for (row = first_row; row <= last_row; row++) {
+    for (i = 0; i < width; i++) {
+      if (DEVICE_TYPE(row, position_x + i) != DEVICE_TYPE(origin_row + row - first_row, origin_x + i)) {
+        return 0;
+      }
+    }
+  }
+  #if PBS_STORE
+    pblock pblock_1;
+
+    pblock_1.X0 = position_x;
+    pblock_1.Y0 = position_y;
+    pblock_1.Xf = position_x + width - 1;
+    pblock_1.Yf = position_y + height - 1;
+    if (PBS_store_check_geometry(element_info, &pblock_1) != XST_SUCCESS) {
+      return 0;
+    }
+  #endif
+  return 1;
+}
+
+static int is_position_free(virtual_architecture_t *virtual_architecture, int position_x, int position_y, int width, int height) {
+  int i, j;
+  partition_t *partition;
+  element_info_t *element;
+
+  for (i = 0; i < MAX_WIDTH_VIRTUAL_ARCHITECTURE; i++) {
+    for (j = 0; j < MAX_HEIGHT_VIRTUAL_ARCHITECTURE; j++) {
+      partition = &virtual_architecture->partition[i][j];
+      element = partition->allocated_element != NULL ? partition->allocated_element : partition->element.element_info;
+      if (element == NULL) {
+        continue;
+      }
+      if (position_x <= partition->position[X_POS] + element->size[WIDTH_POS] - 1 && 
+          partition->position[X_POS] <= position_x + width - 1 &&
+          position_y <= partition->position[Y_POS] + element->size[HEIGHT_POS] - 1 && 
+          partition->position[Y_POS] <= position_y + height - 1) {
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+#endif
+
+int change_partition_position(virtual_architecture_t *virtual_architecture, int x, int y, int position_x, int position_y) {
+  if (position_x < 0 || position_x >= fpga_device->columns || position_y < 0 || position_y >= fpga_device->rows * CLOCK_REGION_ROWS) {
+    return XST_FAILURE;
+  }
+  #if FINE_GRAIN
+    release_partition_fine_grain(virtual_architecture, x, y);
+  #endif
   virtual_architecture->partition[x][y].element.element_info = NULL;
   virtual_architecture->partition[x][y].position[X_POS] = position_x;
   virtual_architecture->partition[x][y].position[Y_POS] = position_y;
   update_partition_location_info(virtual_architecture, x, y);
+  return XST_SUCCESS;
 }
 
 static void update_partition_location_info(virtual_architecture_t *virtual_architecture, int x, int y) {
   int partition_x, partition_y, partition_size_x, partition_size_y;
   
+  // The location is updated again when an element is placed in the partition
+  if (virtual_architecture->partition[x][y].element.element_info == NULL) {
+    return;
+  }
   partition_x = virtual_architecture->partition[x][y].position[X_POS];
   partition_y = virtual_architecture->partition[x][y].position[Y_POS];
   partition_size_x = virtual_architecture->partition[x][y].element.element_info->size[WIDTH_POS];
   partition_size_y = virtual_architecture->partition[x][y].element.element_info->size[HEIGHT_POS];
   
-  virtual_architecture->partition[x][y].location_info.first_row = partition_y / ROWS_PER_CLOCK_REGION;
-  virtual_architecture->partition[x][y].location_info.last_row = (partition_y + partition_size_y - 1) / ROWS_PER_CLOCK_REGION;
+  virtual_architecture->partition[x][y].location_info.first_row = partition_y / CLOCK_REGION_ROWS;
+  virtual_architecture->partition[x][y].location_info.last_row = (partition_y + partition_size_y - 1) / CLOCK_REGION_ROWS;
   virtual_architecture->partition[x][y].location_info.first_column = partition_x;
   virtual_architecture->partition[x][y].location_info.last_column = partition_x + partition_size_x - 1;
 }
@@ -250,20 +742,226 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
   }
 
   /*
-  * TODO in this first version the midle+fine grain support is only possible with blocks
-  * completely contained in a clock region row (it can not cross vertical clock regions)
-  * if a PR is bigger than a clock region it must occupy the full heigh of the lowest
-  * clock region row.
+  * The fine-grain components of an element can span up to MAX_CLOCK_ROWS_PER_ELEMENT
+  * clock region rows. In each column they are placed from the first row of the 
+  * partition in the lowest clock region row to its last row in the highest one,
+  * using a different frame for every clock region row.
   * NOTE for the next version it could be possible to use the pblock parameter even in the
   * RP and therefore have pblocks inside pblocks. Para esto lo que podemos hacer es guardar los 2 pblocks
   * el original y el de grano fino y con los 2 sacar el tamaño del pblock y la ubicacion de las constantes.
   * En la proxima version permitir cualquier combinacion.
   */
 
+  static void init_frame_slot_map() {
+    int i;
+    for (i = 0; i < FRAME_SLOT_MAP_SIZE; i++) {
+      frame_slot_map[i].slot = FRAME_SLOT_EMPTY;
+    }
+    num_constant_frames = 0;
+    num_mux_frames = 0;
+    num_FU_frames = 0;
+    num_constant_free_frames = 0;
+    num_mux_free_frames = 0;
+    num_FU_free_frames = 0;
+    num_constant_dirty_frames = 0;
+    num_mux_dirty_frames = 0;
+    num_FU_dirty_frames = 0;
+  }
+
+  /*
+  * Returns the slot of the *_t_frames array of the element type that holds a
+  * frame address. A new slot is assigned the first time a frame address is 
+  * used, reusing the released ones first. It returns -1 if there are no free
+  * slots.
+  */
+  static int get_frame_slot(uint32_t element_type, uint32_t frame_address) {
+    uint32_t i, n;
+    int slot, deleted;
+
+    deleted = -1;
+    i = ((frame_address * 2654435761u) ^ element_type) % FRAME_SLOT_MAP_SIZE;
+    for (n = 0; n < FRAME_SLOT_MAP_SIZE && frame_slot_map[i].slot != FRAME_SLOT_EMPTY; n++) {
+      if (frame_slot_map[i].slot == FRAME_SLOT_DELETED) {
+        if (deleted == -1) {
+          deleted = i;
+        }
+      } else if (frame_slot_map[i].frame_address == frame_address && frame_slot_map[i].element_type == element_type) {
+        return frame_slot_map[i].slot;
+      }
+      i = (i + 1) % FRAME_SLOT_MAP_SIZE;
+    }
+    if (deleted != -1) {
+      i = deleted;
+    } else if (n == FRAME_SLOT_MAP_SIZE) {
+      return -1;
+    }
+
+    if (element_type == CONST_TYPE && num_constant_free_frames > 0) {
+      slot = constant_free_frames[--num_constant_free_frames];
+    } else if (element_type == CONST_TYPE && num_constant_frames < MAX_COLUMNS_CONSTANTS) {
+      slot = num_constant_frames++;
+    } else if (element_type == MUX_TYPE && num_mux_free_frames > 0) {
+      slot = mux_free_frames[--num_mux_free_frames];
+    } else if (element_type == MUX_TYPE && num_mux_frames < MAX_COLUMNS_MUX) {
+      slot = num_mux_frames++;
+    } else if (element_type == FU_TYPE && num_FU_free_frames > 0) {
+      slot = FU_free_frames[--num_FU_free_frames];
+    } else if (element_type == FU_TYPE && num_FU_frames < MAX_COLUMNS_FU) {
+      slot = num_FU_frames++;
+    } else {
+      return -1;
+    }
+    if (element_type == CONST_TYPE) {
+      constant_t_frames[slot].frame_address = frame_address;
+    } else if (element_type == MUX_TYPE) {
+      mux_t_frames[slot].frame_address = frame_address;
+    } else {
+      FU_t_frames[slot].frame_address = frame_address;
+    }
+    frame_slot_map[i].frame_address = frame_address;
+    frame_slot_map[i].element_type = element_type;
+    frame_slot_map[i].slot = slot;
+    return slot;
+  }
+
+  /*
+  * Returns the slot of a frame address used by a layout and records that the
+  * layout references it. Each layout counts once per slot.
+  */
+  static int acquire_frame_slot(fine_grain_layout_t *layout, uint32_t element_type, uint32_t frame_address) {
+    int i, slot;
+
+    slot = get_frame_slot(element_type, frame_address);
+    if (slot == -1) {
+      return -1;
+    }
+    if (element_type == CONST_TYPE) {
+      for (i = 0; i < layout->num_constant_slots && layout->constant_slots[i] != slot; i++) { }
+      if (i == layout->num_constant_slots) {
+        layout->constant_slots[layout->num_constant_slots++] = slot;
+        constant_frames_refs[slot]++;
+      }
+    } else if (element_type == MUX_TYPE) {
+      for (i = 0; i < layout->num_mux_slots && layout->mux_slots[i] != slot; i++) { }
+      if (i == layout->num_mux_slots) {
+        layout->mux_slots[layout->num_mux_slots++] = slot;
+        mux_frames_refs[slot]++;
+      }
+    } else {
+      for (i = 0; i < layout->num_FU_slots && layout->FU_slots[i] != slot; i++) { }
+      if (i == layout->num_FU_slots) {
+        layout->FU_slots[layout->num_FU_slots++] = slot;
+        FU_frames_refs[slot]++;
+      }
+    }
+    return slot;
+  }
+
+  /*
+  * Drops a reference to a slot. The last one removes its frame address from
+  * the map (leaving a tombstone), discards its pending changes and returns the
+  * slot to the free list of its type.
+  */
+  static void release_frame_slot(uint32_t element_type, int slot) {
+    uint32_t i, n, frame_address;
+    int j;
+
+    if (element_type == CONST_TYPE) {
+      if (constant_frames_refs[slot] == 0 || --constant_frames_refs[slot] > 0) {
+        return;
+      }
+      frame_address = constant_t_frames[slot].frame_address;
+    } else if (element_type == MUX_TYPE) {
+      if (mux_frames_refs[slot] == 0 || --mux_frames_refs[slot] > 0) {
+        return;
+      }
+      frame_address = mux_t_frames[slot].frame_address;
+    } else {
+      if (FU_frames_refs[slot] == 0 || --FU_frames_refs[slot] > 0) {
+        return;
+      }
+      frame_address = FU_t_frames[slot].frame_address;
+    }
+
+    i = ((frame_address * 2654435761u) ^ element_type) % FRAME_SLOT_MAP_SIZE;
+    for (n = 0; n < FRAME_SLOT_MAP_SIZE && frame_slot_map[i].slot != FRAME_SLOT_EMPTY; n++) {
+      if (frame_slot_map[i].slot == slot && frame_slot_map[i].element_type == element_type) {
+        frame_slot_map[i].slot = FRAME_SLOT_DELETED;
+        break;
+      }
+      i = (i + 1) % FRAME_SLOT_MAP_SIZE;
+    }
+
+    // A free slot has no frame address, so the snapshots taken while it was in use no longer match
+    if (element_type == CONST_TYPE) {
+      if (constant_frames_flags[slot] == RECONFIGURE_FRAME) {
+        for (j = 0; constant_dirty_frames[j] != slot; j++) { }
+        constant_dirty_frames[j] = constant_dirty_frames[--num_constant_dirty_frames];
+        constant_frames_flags[slot] = DO_NOT_RECONFIGURE_FRAME;
+      }
+      memset(&constant_t_frames[slot], 0, sizeof(constant_t_frames[slot]));
+      constant_free_frames[num_constant_free_frames++] = slot;
+    } else if (element_type == MUX_TYPE) {
+      if (mux_frames_flags[slot] == RECONFIGURE_FRAME) {
+        for (j = 0; mux_dirty_frames[j] != slot; j++) { }
+        mux_dirty_frames[j] = mux_dirty_frames[--num_mux_dirty_frames];
+        mux_frames_flags[slot] = DO_NOT_RECONFIGURE_FRAME;
+      }
+      memset(&mux_t_frames[slot], 0, sizeof(mux_t_frames[slot]));
+      mux_free_frames[num_mux_free_frames++] = slot;
+    } else {
+      if (FU_frames_flags[slot] == RECONFIGURE_FRAME) {
+        for (j = 0; FU_dirty_frames[j] != slot; j++) { }
+        FU_dirty_frames[j] = FU_dirty_frames[--num_FU_dirty_frames];
+        FU_frames_flags[slot] = DO_NOT_RECONFIGURE_FRAME;
+      }
+      memset(&FU_t_frames[slot], 0, sizeof(FU_t_frames[slot]));
+      FU_free_frames[num_FU_free_frames++] = slot;
+    }
+  }
+
+  static void release_layout_frame_slots(fine_grain_layout_t *layout) {
+    int i;
+    for (i = 0; i < layout->num_constant_slots; i++) {
+      release_frame_slot(CONST_TYPE, layout->constant_slots[i]);
+    }
+    for (i = 0; i < layout->num_mux_slots; i++) {
+      release_frame_slot(MUX_TYPE, layout->mux_slots[i]);
+    }
+    for (i = 0; i < layout->num_FU_slots; i++) {
+      release_frame_slot(FU_TYPE, layout->FU_slots[i]);
+    }
+    layout->num_constant_slots = 0;
+    layout->num_mux_slots = 0;
+    layout->num_FU_slots = 0;
+  }
+
+  static void set_constant_frame_dirty(int slot) {
+    if (constant_frames_flags[slot] == DO_NOT_RECONFIGURE_FRAME) {
+      constant_frames_flags[slot] = RECONFIGURE_FRAME;
+      constant_dirty_frames[num_constant_dirty_frames++] = slot;
+    }
+  }
+
+  static void set_mux_frame_dirty(int slot) {
+    if (mux_frames_flags[slot] == DO_NOT_RECONFIGURE_FRAME) {
+      mux_frames_flags[slot] = RECONFIGURE_FRAME;
+      mux_dirty_frames[num_mux_dirty_frames++] = slot;
+    }
+  }
+
+  static void set_FU_frame_dirty(int slot) {
+    if (FU_frames_flags[slot] == DO_NOT_RECONFIGURE_FRAME) {
+      FU_frames_flags[slot] = RECONFIGURE_FRAME;
+      FU_dirty_frames[num_FU_dirty_frames++] = slot;
+    }
+  }
+
   static void init_constant_frames() {
     int i, j;
     for (i = 0; i < MAX_COLUMNS_CONSTANTS; i++) {
       constant_frames_flags[i] = DO_NOT_RECONFIGURE_FRAME;
+      constant_frames_refs[i] = 0;
       constant_t_frames[i].frame_address = 0;
       for (j = 0; j < WORDS_PER_CONSTANTS; j++) {
         constant_t_frames[i].value[j] = 0;
@@ -275,6 +973,7 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
     int i, j;
     for (i = 0; i < MAX_COLUMNS_MUX; i++) {
       mux_frames_flags[i] = DO_NOT_RECONFIGURE_FRAME;
+      mux_frames_refs[i] = 0;
       mux_t_frames[i].frame_address = 0;
       for (j = 0; j < WORDS_PER_MUX; j++) {
         mux_t_frames[i].value[j] = 0;
@@ -286,6 +985,7 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
     int i, j;
     for (i = 0; i < MAX_COLUMNS_FU; i++) {
       FU_frames_flags[i] = DO_NOT_RECONFIGURE_FRAME;
+      FU_frames_refs[i] = 0;
       FU_t_frames[i].frame_address = 0;
       for (j = 0; j < WORDS_PER_FU; j++) {
         FU_t_frames[i].value[j] = 0;
@@ -378,12 +1078,18 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
     }
   }
 
-  void add_fine_grain_static_region(virtual_architecture_t *virtual_architecture, int x, int y, int element_info) {
-    
+  int add_fine_grain_static_region(virtual_architecture_t *virtual_architecture, int x, int y, int element_info) {
+    if (element_info < 0 || element_info >= NUM_ELEMENTS) {
+      return XST_FAILURE;
+    }
     virtual_architecture->partition[x][y].element.element_info = &elements[element_info];
     update_partition_location_info(virtual_architecture, x, y);
-    update_partition_fine_grain_info(virtual_architecture, x, y);
+    if (update_partition_fine_grain_info(virtual_architecture, x, y) != XST_SUCCESS) {
+      virtual_architecture->partition[x][y].element.element_info = NULL;
+      return XST_FAILURE;
+    }
     reset_fine_grain_elements(virtual_architecture, x, y);
+    return XST_SUCCESS;
   }
 
 
@@ -395,12 +1101,46 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
     int num_blocks;
     int *offset_in_blocks;
     int status;
+    fine_grain_layout_t *fine_grain;
+    
+    // The fine-grain state is only allocated for partitions that need it
+    if (virtual_architecture->partition[x][y].element.element_info->num_constants == 0 &&
+        virtual_architecture->partition[x][y].element.element_info->num_muxes == 0 &&
+        virtual_architecture->partition[x][y].element.element_info->num_FU == 0) {
+      release_partition_fine_grain(virtual_architecture, x, y);
+      return XST_SUCCESS;
+    }
+    
+    // The position of the LUT contents in the frames is only known for 7 series devices
+    if (!DEVICE_FAMILY->fine_grain) {
+      release_partition_fine_grain(virtual_architecture, x, y);
+      return XST_FAILURE;
+    }
+    
+    if (virtual_architecture->partition[x][y].element.fine_grain == NULL) {
+      if (num_free_fine_grain_layouts > 0) {
+        fine_grain = &fine_grain_layouts[free_fine_grain_layouts[--num_free_fine_grain_layouts]];
+      } else if (num_fine_grain_layouts < MAX_FINE_GRAIN_PARTITIONS) {
+        fine_grain = &fine_grain_layouts[num_fine_grain_layouts++];
+      } else {
+        return XST_FAILURE;
+      }
+      fine_grain->in_use = 1;
+      virtual_architecture->partition[x][y].element.fine_grain = fine_grain;
+    } else {
+      // The frames of the previous layout are released before computing the new one
+      release_layout_frame_slots(virtual_architecture->partition[x][y].element.fine_grain);
+    }
     
     height_fine_grain = virtual_architecture->partition[x][y].element.element_info->size[HEIGHT_POS];
-    first_clock_row = virtual_architecture->partition[x][y].position[Y_POS] / ROWS_PER_CLOCK_REGION;
-    last_clock_row = (virtual_architecture->partition[x][y].position[Y_POS] + height_fine_grain - 1) / ROWS_PER_CLOCK_REGION;
-    first_row = virtual_architecture->partition[x][y].position[Y_POS] % ROWS_PER_CLOCK_REGION;
-    last_row = (virtual_architecture->partition[x][y].position[Y_POS] + height_fine_grain - 1) % ROWS_PER_CLOCK_REGION;
+    first_clock_row = virtual_architecture->partition[x][y].position[Y_POS] / CLOCK_REGION_ROWS;
+    last_clock_row = (virtual_architecture->partition[x][y].position[Y_POS] + height_fine_grain - 1) / CLOCK_REGION_ROWS;
+    first_row = virtual_architecture->partition[x][y].position[Y_POS] % CLOCK_REGION_ROWS;
+    last_row = (virtual_architecture->partition[x][y].position[Y_POS] + height_fine_grain - 1) % CLOCK_REGION_ROWS;
+    if (last_clock_row - first_clock_row + 1 > MAX_CLOCK_ROWS_PER_ELEMENT) {
+      release_partition_fine_grain(virtual_architecture, x, y);
+      return XST_FAILURE;
+    }
     
     num_blocks = virtual_architecture->partition[x][y].element.element_info->num_blocks;
     offset_in_blocks = virtual_architecture->partition[x][y].element.element_info->offset_blocks;
@@ -409,18 +1149,39 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
       column_number = offset_in_blocks[i];
       status = calculate_constant_parameters(virtual_architecture, x, y, first_clock_row, last_clock_row, first_row, last_row, &column_number, offset_in_blocks[i]);
       if (status == -1) {
-        return -1;
+        release_partition_fine_grain(virtual_architecture, x, y);
+        return XST_FAILURE;
       }
       status = calculate_mux_parameters(virtual_architecture, x, y, first_clock_row, last_clock_row, first_row, last_row, &column_number, offset_in_blocks[i]);
       if (status == -1) {
-        return -1;
+        release_partition_fine_grain(virtual_architecture, x, y);
+        return XST_FAILURE;
       }
       status = calculate_FU_parameters(virtual_architecture, x, y, first_clock_row, last_clock_row, first_row, last_row, &column_number, offset_in_blocks[i]);
       if (status == -1) {
-        return -1;
+        release_partition_fine_grain(virtual_architecture, x, y);
+        return XST_FAILURE;
       }
     }
-    return 0;
+    return XST_SUCCESS;
+  }
+
+  /*
+  * Returns the fine-grain layout of a partition and its frame slots to the free
+  * lists. It is called when the partition is invalidated or moved, when it
+  * holds an element without fine-grain components and when the layout fails.
+  */
+  static void release_partition_fine_grain(virtual_architecture_t *virtual_architecture, int x, int y) {
+    fine_grain_layout_t *fine_grain;
+
+    fine_grain = virtual_architecture->partition[x][y].element.fine_grain;
+    if (fine_grain == NULL) {
+      return;
+    }
+    release_layout_frame_slots(fine_grain);
+    fine_grain->in_use = 0;
+    free_fine_grain_layouts[num_free_fine_grain_layouts++] = fine_grain - fine_grain_layouts;
+    virtual_architecture->partition[x][y].element.fine_grain = NULL;
   }
 
   #define BITS_PER_CLB 		  8
@@ -431,6 +1192,10 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
     int first_bit_in_column, last_bit_in_column, total_bits_to_send, bits_to_send;
     int clock_row_number, initial_column, num_constants;
     uint32_t frame_address;
+    // Segments of the constant being placed, used to build its scatter plan
+    int frame_address_position[MAX_COLUMNS_CONSTANT_PER_ELEMENT];
+    int first_bit_in_frame[MAX_COLUMNS_CONSTANT_PER_ELEMENT];
+    int last_bit_in_frame[MAX_COLUMNS_CONSTANT_PER_ELEMENT];
     
     initial_column = *column;
     
@@ -455,21 +1220,15 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
       total_bits_to_send = virtual_architecture->partition[x][y].element.element_info->num_bits_in_constant[i];
       j = 0;
       while (total_bits_to_send > 0) {
+        if (j == MAX_COLUMNS_CONSTANT_PER_ELEMENT) {
+          return -1;
+        }
         frame_address = obtain_frame_address_of_CLB_column(virtual_architecture, x, y, clock_row_number, *column);
         if (frame_address == -1) {
           return -1;
         }
-        for (k = 0; k < MAX_COLUMNS_CONSTANTS; k++) {
-          // We search for an empty frame address or for a previous equal frame address.
-          if (constant_t_frames[k].frame_address != frame_address && constant_t_frames[k].frame_address != 0) {
-            continue;
-          }
-          else {
-            constant_t_frames[k].frame_address = frame_address;
-            break;
-          }
-        }
-        if (k == MAX_COLUMNS_CONSTANTS) {
+        k = acquire_frame_slot(virtual_architecture->partition[x][y].element.fine_grain, CONST_TYPE, frame_address);
+        if (k == -1) {
           return -1;
         }
         if (total_bits_to_send > (last_bit_in_column + 1 - first_bit_in_column)) {
@@ -477,10 +1236,10 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
         } else {
           bits_to_send = total_bits_to_send;
         }
-        virtual_architecture->partition[x][y].element.constant_frame_address_position[i][j] = k;
-        virtual_architecture->partition[x][y].element.first_bit_in_frame[i][j] = first_bit_in_column;
+        frame_address_position[j] = k;
+        first_bit_in_frame[j] = first_bit_in_column;
         first_bit_in_column += bits_to_send;
-        virtual_architecture->partition[x][y].element.last_bit_in_frame[i][j] = first_bit_in_column - 1;
+        last_bit_in_frame[j] = first_bit_in_column - 1;
         total_bits_to_send -= bits_to_send;
         if (total_bits_to_send == 0 && i == (num_constants - 1)) {
           //If it is the last constant we start a new column in the first row where the LUT muxes are going to be placed.
@@ -507,6 +1266,7 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
         }
         j++;
       }
+      calculate_constant_scatter_plan(virtual_architecture->partition[x][y].element.fine_grain, i, j, frame_address_position, first_bit_in_frame, last_bit_in_frame);
       //If the constant has an odd number of bits we have to add one because the next constant will start in a new LUT.
       if (first_bit_in_column % 2 != 0) {
         first_bit_in_column += 1;
@@ -515,6 +1275,46 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
     return 0;
   }
 
+  /*
+  * Splits every frame segment of a constant in pieces that do not cross a
+  * word boundary neither in the constant value nor in the frame, so that
+  * change_partition_constant() only needs one masked store per piece.
+  */
+  static void calculate_constant_scatter_plan(fine_grain_layout_t *element, int constant_number, int num_segments, const int *frame_address_position, const int *first_bit_in_frame, const int *last_bit_in_frame) {
+    int segment, first_bit, last_bit, bits, bits_sent, num_ops;
+    constant_scatter_t *op;
+
+    num_ops = 0;
+    bits_sent = 0;
+    for (segment = 0; segment < num_segments; segment++) {
+      first_bit = first_bit_in_frame[segment];
+      last_bit = last_bit_in_frame[segment];
+      while (first_bit <= last_bit) {
+        bits = 32 - (first_bit % 32);
+        if (bits > 32 - (bits_sent % 32)) {
+          bits = 32 - (bits_sent % 32);
+        }
+        if (bits > last_bit + 1 - first_bit) {
+          bits = last_bit + 1 - first_bit;
+        }
+        op = &element->constant_scatter[constant_number][num_ops];
+        op->frame_address_position = frame_address_position[segment];
+        op->src_word = bits_sent / 32;
+        op->dst_word = first_bit / 32;
+        op->shift = (first_bit % 32) - (bits_sent % 32);
+        if (bits == 32) {
+          op->mask = 0xFFFFFFFF;
+        } else {
+          op->mask = (((uint32_t) 0x1 << bits) - 1) << (first_bit % 32);
+        }
+        num_ops++;
+        first_bit += bits;
+        bits_sent += bits;
+      }
+    }
+    element->num_constant_scatter_ops[constant_number] = num_ops;
+  }
+
   #define MAX_LUTS_IN_CLOCK_ROW 200
   #define LUTS_PER_CLB 		  4
 
@@ -525,6 +1325,11 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
     int first_LUT_in_column, last_LUT_in_column, initial_column, num_muxes;
     int clock_row_number;
     uint32_t frame_address;
+    // Segments of the mux being placed, used to build its encoding table
+    int frame_address_position[MAX_COLUMNS_MUX_PER_ELEMENT];
+    int first_LUT_in_frame[MAX_COLUMNS_MUX_PER_ELEMENT];
+    int last_LUT_in_frame[MAX_COLUMNS_MUX_PER_ELEMENT];
+    int LUT_position_in_frame[MAX_COLUMNS_MUX_PER_ELEMENT];
     
     initial_column = *column;
     
@@ -549,25 +1354,18 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
       }
       num_inputs = virtual_architecture->partition[x][y].element.element_info->mux_num_inputs[i];
       total_LUTs_to_send = LUTs_in_mux(virtual_architecture->partition[x][y].element.element_info->mux_data_width[i], num_inputs);
-      virtual_architecture->partition[x][y].element.total_LUTs_in_mux[i] = total_LUTs_to_send;
       j = 0;
       LUT_position = 0;
       while (total_LUTs_to_send > 0) {
+        if (j == MAX_COLUMNS_MUX_PER_ELEMENT) {
+          return -1;
+        }
         frame_address = obtain_frame_address_of_CLB_column(virtual_architecture, x, y, clock_row_number, *column);
         if (frame_address == -1) {
           return -1;
         }
-        for (k = 0; k < MAX_COLUMNS_MUX; k++) {
-          // We search for an empty frame address or for a previous equal frame address.
-          if (mux_t_frames[k].frame_address != frame_address && mux_t_frames[k].frame_address != 0) {
-            continue;
-          }
-          else {
-            mux_t_frames[k].frame_address = frame_address;
-            break;
-          }
-        }
-        if (k == MAX_COLUMNS_MUX) {
+        k = acquire_frame_slot(virtual_architecture->partition[x][y].element.fine_grain, MUX_TYPE, frame_address);
+        if (k == -1) {
           return -1;
         }
         if (total_LUTs_to_send > (last_LUT_in_column + 1 - first_LUT_in_column)) {
@@ -575,11 +1373,11 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
         } else {
           LUTs_to_send = total_LUTs_to_send;
         }
-        virtual_architecture->partition[x][y].element.mux_frame_address_position[i][j] = k;
-        virtual_architecture->partition[x][y].element.first_LUT_in_frame[i][j] = first_LUT_in_column;
+        frame_address_position[j] = k;
+        first_LUT_in_frame[j] = first_LUT_in_column;
         first_LUT_in_column += LUTs_to_send;
-        virtual_architecture->partition[x][y].element.last_LUT_in_frame[i][j] = first_LUT_in_column - 1;
-        virtual_architecture->partition[x][y].element.LUT_position_in_frame[i][j] = LUT_position;
+        last_LUT_in_frame[j] = first_LUT_in_column - 1;
+        LUT_position_in_frame[j] = LUT_position;
         LUT_position = (LUT_position + LUTs_to_send) % (((num_inputs - 2) / 3) + 1);
         total_LUTs_to_send -= LUTs_to_send;
         if (total_LUTs_to_send == 0 && i == (num_muxes - 1)) {
@@ -607,14 +1405,79 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
         }
         j++;
       }
+      if (calculate_mux_encoding_table(virtual_architecture->partition[x][y].element.fine_grain, i, j, num_inputs, frame_address_position, first_LUT_in_frame, last_LUT_in_frame, LUT_position_in_frame) == -1) {
+        return -1;
+      }
     }
     return 0;
   }
 
+  /*
+  * Builds, for every frame word that contains LUTs of the mux, the mask of its
+  * select bits and their contents for each select value, so that
+  * change_partition_mux() only needs one masked store per word. The contents
+  * are stored by select value to read them contiguously.
+  */
+  static int calculate_mux_encoding_table(fine_grain_layout_t *element, int mux_number, int num_segments, int num_inputs, const int *frame_address_position, const int *first_LUT_in_frame, const int *last_LUT_in_frame, const int *LUT_position_in_frame) {
+    int segment, first_LUT, last_LUT, LUT_position, num_words, value;
+    uint32_t j, k, first_frame_LUT, last_frame_LUT;
+    fine_grain_segment_t *mux_segment;
+
+    if (num_inputs > MAX_MUX_INPUTS) {
+      return -1;
+    }
+    num_words = 0;
+    for (segment = 0; segment < num_segments; segment++) {
+      first_LUT = first_LUT_in_frame[segment];
+      last_LUT = last_LUT_in_frame[segment];
+      LUT_position = LUT_position_in_frame[segment];
+      for (j = first_LUT / 16; j <= last_LUT / 16; j++) {
+        if (num_words == MAX_MUX_ENCODING_WORDS) {
+          return -1;
+        }
+        mux_segment = &element->mux_segments[mux_number][num_words];
+        mux_segment->frame_address_position = frame_address_position[segment];
+        mux_segment->word = j;
+        mux_segment->mask = 0;
+        for (value = 0; value < MAX_MUX_INPUTS; value++) {
+          element->mux_select_words[mux_number][value][num_words] = 0;
+        }
+        first_frame_LUT = (j == first_LUT / 16) ? first_LUT % 16 : 0;
+        last_frame_LUT = (j == last_LUT / 16) ? last_LUT % 16 : 15;
+        for (k = first_frame_LUT; k <= last_frame_LUT; k++) {
+          mux_segment->mask |= ((uint32_t) 0x3 << k*2);
+          for (value = 0; value < num_inputs; value++) {
+            element->mux_select_words[mux_number][value][num_words] |= get_mux_LUT_select(value, LUT_position) << k*2;
+          }
+          LUT_position = (LUT_position + 1) % (((num_inputs - 2) / 3) + 1);
+        }
+        num_words++;
+      }
+    }
+    element->num_mux_segments[mux_number] = num_words;
+    return 0;
+  }
+
+  /*
+  * The first LUT of a mux selects inputs 0 to 3 and each chained LUT three more.
+  * The LUTs after the one that holds the selected input pass the chain (0x3).
+  */
+  static uint32_t get_mux_LUT_select(int value, int LUT_position) {
+    if (((value - 1) / 3) > LUT_position) {
+      return 0; //We don't care about the value of lower LUTs
+    } else if (((value - 1) / 3) < LUT_position) {
+      return 0x3;
+    } else if (value <= 3) {
+      return value;
+    } else {
+      return (value - 4) % 3;
+    }
+  }
+
   #define CLBS_IN_COLUMN	50
 
   static int calculate_FU_parameters(virtual_architecture_t *virtual_architecture, int x, int y, int first_clock_row, int last_clock_row, int first_row, int last_row, int *column, int offset) {
-    int i,j,k;
+    int i,k;
     int first_block_first_clock_row, last_block_first_clock_row, first_block_last_clock_row, last_block_last_clock_row;
     int first_block_in_column, last_block_in_column, total_blocks_to_send;
     int clock_row_number, blocks_to_send, initial_column, num_FU;
@@ -644,23 +1507,14 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
         continue;
       }
       total_blocks_to_send = 2*virtual_architecture->partition[x][y].element.element_info->FU_4_bit_blocks[i];
-      j = 0;
+      virtual_architecture->partition[x][y].element.fine_grain->num_FU_segments[i] = 0;
       while (total_blocks_to_send > 0) {
         frame_address = obtain_frame_address_of_CLB_column(virtual_architecture, x, y, clock_row_number, (*column));
         if (frame_address == -1) {
           return -1;
         }
-        for (k = 0; k < MAX_COLUMNS_FU; k++) {
-          // We search for an empty frame address or for a previous equal frame address.
-          if (FU_t_frames[k].frame_address != frame_address && FU_t_frames[k].frame_address != 0) {
-            continue;
-          }
-          else {
-            FU_t_frames[k].frame_address = frame_address;
-            break;
-          }
-        }
-        if (k == MAX_COLUMNS_FU) {
+        k = acquire_frame_slot(virtual_architecture->partition[x][y].element.fine_grain, FU_TYPE, frame_address);
+        if (k == -1) {
           return -1;
         }
         if (total_blocks_to_send > (last_block_in_column + 1 - first_block_in_column)) {
@@ -668,10 +1522,10 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
         } else {
           blocks_to_send = total_blocks_to_send;
         }
-        virtual_architecture->partition[x][y].element.FU_frame_address_position[i][j] = k;
-        virtual_architecture->partition[x][y].element.first_FU_block_in_frame[i][j] = first_block_in_column;
+        if (calculate_FU_segments(virtual_architecture->partition[x][y].element.fine_grain, i, k, first_block_in_column, first_block_in_column + blocks_to_send - 1) == -1) {
+          return -1;
+        }
         first_block_in_column += blocks_to_send;
-        virtual_architecture->partition[x][y].element.last_FU_block_in_frame[i][j] = first_block_in_column - 1;
         total_blocks_to_send -= blocks_to_send;
         if (total_blocks_to_send == 0 && i == (num_FU - 1)) {
           (*column)++;
@@ -692,10 +1546,9 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
             last_block_in_column = last_block_last_clock_row;
           } else {
             first_block_in_column = 0;
-            last_block_in_column = MAX_BITS_IN_CLOCK_ROW - 1;
+            last_block_in_column = CLBS_IN_COLUMN - 1;
           }
         }
-        j++;
       }
     }
     return 0;
@@ -775,14 +1628,18 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
 
   static void reset_fine_grain_elements(virtual_architecture_t *virtual_architecture, int x, int y) {
     int i;
+    if (virtual_architecture->partition[x][y].element.fine_grain == NULL) {
+      return;
+    }
     for (i = 0; i < MAX_CONSTANTS; i++) {
-      virtual_architecture->partition[x][y].element.constants_definition[i].initialized = 0;
+      virtual_architecture->partition[x][y].element.fine_grain->constants_definition[i].initialized = 0;
     }
     for (i = 0; i < MAX_MUXES; i++) {
-      virtual_architecture->partition[x][y].element.mux_definition[i].initialized = 0;
+      virtual_architecture->partition[x][y].element.fine_grain->mux_definition[i].initialized = 0;
     }
     for (i = 0; i < MAX_FU; i++) {
-      virtual_architecture->partition[x][y].element.mux_definition[i].initialized = 0;
+      virtual_architecture->partition[x][y].element.fine_grain->FU_definition[i].initialized = 0;
+      virtual_architecture->partition[x][y].element.fine_grain->FU_definition[i].slot = -1;
     }
   }
 
@@ -799,250 +1656,155 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
   *
   * NOTE in overlays constant columns come first then mux columns and finally FUs.
   */
-  void change_partition_constant(virtual_architecture_t *virtual_architecture, int x, int y, int constant_number, uint32_t value[MAX_WORDS_PER_CONSTANT]) {
+  int change_partition_constant(virtual_architecture_t *virtual_architecture, int x, int y, int constant_number, uint32_t value[MAX_WORDS_PER_CONSTANT]) {
       int i;
-      int total_bits_to_send, bits_sent, first_bit, last_bit, bits_to_send;
-      uint32_t frame_address_position;
-
-      total_bits_to_send = virtual_architecture->partition[x][y].element.element_info->num_bits_in_constant[constant_number];
+      uint32_t aux_value;
+      constant_scatter_t *op;
 
+      if (virtual_architecture->partition[x][y].element.fine_grain == NULL ||
+          constant_number < 0 || constant_number >= virtual_architecture->partition[x][y].element.element_info->num_constants) {
+        return XST_FAILURE;
+      }
       #if SEARCH_IF_FINE_GRAIN_VALUE_HAS_CHANGED == 1
+        int total_bits_to_send;
         int same_value = 1;
 
+        total_bits_to_send = virtual_architecture->partition[x][y].element.element_info->num_bits_in_constant[constant_number];
+
       for (i = 0; i <= ((total_bits_to_send-1)/32); i++) {
-        if (value[i] != virtual_architecture->partition[x][y].element.constants_definition[constant_number].value[i]) {
+        if (value[i] != virtual_architecture->partition[x][y].element.fine_grain->constants_definition[constant_number].value[i]) {
           same_value = 0;
-          virtual_architecture->partition[x][y].element.constants_definition[constant_number].value[i] = value[i];
+          virtual_architecture->partition[x][y].element.fine_grain->constants_definition[constant_number].value[i] = value[i];
         }
       }
       // The constant already has that value
-      if (same_value == 1 && virtual_architecture->partition[x][y].element.constants_definition[constant_number].initialized == 1) {
-        return;
+      if (same_value == 1 && virtual_architecture->partition[x][y].element.fine_grain->constants_definition[constant_number].initialized == 1) {
+        return XST_SUCCESS;
       }
 
-        virtual_architecture->partition[x][y].element.constants_definition[constant_number].initialized = 1;
+        virtual_architecture->partition[x][y].element.fine_grain->constants_definition[constant_number].initialized = 1;
       #endif
 
-      bits_sent = 0;
-      i = 0;
-      while (total_bits_to_send > bits_sent) {
-        frame_address_position = virtual_architecture->partition[x][y].element.constant_frame_address_position[constant_number][i];
-        first_bit = virtual_architecture->partition[x][y].element.first_bit_in_frame[constant_number][i];
-        last_bit = virtual_architecture->partition[x][y].element.last_bit_in_frame[constant_number][i];
-        bits_to_send = last_bit + 1 - first_bit;
- 		if ((bits_to_send == 32) && ((first_bit % 32) == 0)) {
- 			constant_t_frames[frame_address_position].value[first_bit/32] = value[0];
- 			constant_frames_flags[frame_address_position] = RECONFIGURE_FRAME;
- 			return;
- 		} else if ((bits_to_send == 16) && ((first_bit % 16) == 0)) {
- 			//tmp = first_bit/32;
- 			if ((first_bit%32) == 0) {
- 				constant_t_frames[frame_address_position].value[first_bit/32] = (constant_t_frames[frame_address_position].value[first_bit/32]&0xFFFF0000) | (value[0]&0x0000FFFF);
- 			} else {
- 				constant_t_frames[frame_address_position].value[first_bit/32] = (constant_t_frames[frame_address_position].value[first_bit/32]&0x0000FFFF) | (value[0]<<16);
- 			}
- 			constant_frames_flags[frame_address_position] = RECONFIGURE_FRAME;
- 			return;
-         } else {
- 			change_constant_frame_address(frame_address_position, first_bit, last_bit, bits_sent, &value[0]);
- 		}
- 		//change_constant_frame_address(frame_address_position, first_bit, last_bit, bits_sent, &value[0]);
-        i++;
-        bits_sent += bits_to_send;
-      }
-    }
-
-   static void change_constant_frame_address(uint32_t frame_address_position, int first_bit, int last_bit, int previous_bits_sent, uint32_t *value) {
-      uint32_t first_frame_word, first_frame_bit, last_frame_word, last_frame_bit, frame_mask;
-      uint32_t aux_value;
-      uint32_t j, k;
-
-  	constant_frames_flags[frame_address_position] = RECONFIGURE_FRAME;
-
- 	if (((last_bit + 1 - first_bit) == 32) && ((first_bit % 32) == 0)) {
- 		constant_t_frames[frame_address_position].value[first_bit/32] = value[0];
- 		return;
- 	}
-
-  	first_frame_word = first_bit / 32;
-  	last_frame_word = last_bit / 32;
-
+      for (i = 0; i < virtual_architecture->partition[x][y].element.fine_grain->num_constant_scatter_ops[constant_number]; i++) {
+        op = &virtual_architecture->partition[x][y].element.fine_grain->constant_scatter[constant_number][i];
+        if (op->shift >= 0) {
+          aux_value = value[op->src_word] << op->shift;
+        } else {
+          aux_value = value[op->src_word] >> (-op->shift);
+        }
+        constant_t_frames[op->frame_address_position].value[op->dst_word] = (constant_t_frames[op->frame_address_position].value[op->dst_word] & (~op->mask)) | (aux_value & op->mask);
+        set_constant_frame_dirty(op->frame_address_position);
+      }
+      return XST_SUCCESS;
+    }
 
-  	for (j = first_frame_word; j <= last_frame_word; j++) {
-  	if (j == first_frame_word) {
-  	  first_frame_bit = (first_bit % 32);
-  	} else {
-  	  first_frame_bit = 0;
-  	}
-  	if (j == last_frame_word) {
-  	  last_frame_bit = (last_bit % 32);
-  	} else {
-  	  last_frame_bit = 31;
-  	}
 
-  	aux_value = 0;
-  	frame_mask = 0;
-  	for (k = first_frame_bit; k <= last_frame_bit; k++) {
-  	  frame_mask |= (0x1 << k);
-  	  aux_value |= ((value[previous_bits_sent/32] >> (previous_bits_sent % 32)) & 1) << k;
-  	  previous_bits_sent++;
-  	}
+  int change_partition_mux(virtual_architecture_t *virtual_architecture, int x, int y, int mux_number, int value) {
+    int i, num_segments;
+    fine_grain_segment_t *mux_segment;
+    uint32_t *select_words, *frame;
 
-  	constant_t_frames[frame_address_position].value[j] = (constant_t_frames[frame_address_position].value[j] & (~frame_mask)) | aux_value;
-  	}
+    if (virtual_architecture->partition[x][y].element.fine_grain == NULL ||
+        mux_number < 0 || mux_number >= virtual_architecture->partition[x][y].element.element_info->num_muxes ||
+        value < 0 || value >= virtual_architecture->partition[x][y].element.element_info->mux_num_inputs[mux_number]) {
+      return XST_FAILURE;
     }
-
-
-  void change_partition_mux(virtual_architecture_t *virtual_architecture, int x, int y, int mux_number, int value) {
-    int total_LUTs_to_send, LUTs_to_send, LUT_position, num_inputs, LUTs_sent;
-    int frame_address_position, first_LUT, last_LUT;
-    int i;
     
     #if SEARCH_IF_FINE_GRAIN_VALUE_HAS_CHANGED == 1
       int same_value = 1;
-      if (value != virtual_architecture->partition[x][y].element.mux_definition[mux_number].value) {
+      if (value != virtual_architecture->partition[x][y].element.fine_grain->mux_definition[mux_number].value) {
        same_value = 0;
-       virtual_architecture->partition[x][y].element.mux_definition[mux_number].value = value;
+       virtual_architecture->partition[x][y].element.fine_grain->mux_definition[mux_number].value = value;
       }
 
       // The constant already has that value
-      if (same_value == 1 && virtual_architecture->partition[x][y].element.mux_definition[mux_number].initialized == 1) {
-       return;
+      if (same_value == 1 && virtual_architecture->partition[x][y].element.fine_grain->mux_definition[mux_number].initialized == 1) {
+       return XST_SUCCESS;
       }
 
-      virtual_architecture->partition[x][y].element.mux_definition[mux_number].initialized = 1;
+      virtual_architecture->partition[x][y].element.fine_grain->mux_definition[mux_number].initialized = 1;
     #endif
 
-    num_inputs = virtual_architecture->partition[x][y].element.element_info->mux_num_inputs[mux_number];
-    total_LUTs_to_send = virtual_architecture->partition[x][y].element.total_LUTs_in_mux[mux_number];
-    LUTs_sent = 0;
-    i = 0;
-    while (total_LUTs_to_send > LUTs_sent) {
-      frame_address_position = virtual_architecture->partition[x][y].element.mux_frame_address_position[mux_number][i];
-      first_LUT = virtual_architecture->partition[x][y].element.first_LUT_in_frame[mux_number][i];
-      last_LUT = virtual_architecture->partition[x][y].element.last_LUT_in_frame[mux_number][i];
-      LUTs_to_send = last_LUT + 1 - first_LUT;
-      LUT_position = virtual_architecture->partition[x][y].element.LUT_position_in_frame[mux_number][i];
-      change_mux_frame_address(frame_address_position, first_LUT, last_LUT, value, LUT_position , num_inputs);
-      LUTs_sent += LUTs_to_send;
-      i++;
-    }
-  }
-
-  static void change_mux_frame_address(uint32_t frame_address_position, int first_LUT, int last_LUT, int value, int LUT_position, int num_inputs) {
-    uint32_t first_frame_word, first_frame_LUT, last_frame_word, last_frame_LUT, frame_mask;
-    uint32_t aux_value;
-    uint32_t j, k;
-    
-    
-    
-    mux_frames_flags[frame_address_position] = RECONFIGURE_FRAME;
-    
-    first_frame_word = first_LUT / 16;
-    last_frame_word = last_LUT / 16;
-    
-    for (j = first_frame_word; j <= last_frame_word; j++) {
-      if (j == first_frame_word) {
-        first_frame_LUT = first_LUT % 16;
-      } else {
-        first_frame_LUT = 0;
-      }
-      if (j == last_frame_word) {
-        last_frame_LUT = last_LUT % 16;
-      } else {
-        last_frame_LUT = 15;
-      }
-      
-      frame_mask = 0;
-      aux_value = 0;
-      for (k = first_frame_LUT; k <= last_frame_LUT; k++) {
-        frame_mask |= (0x3 << k*2);
-        if (((value - 1) / 3) > LUT_position) {
-          //We don't care about the value of lower LUTs
-        } else if (((value - 1) / 3) < LUT_position) {
-          aux_value |= (0x3 << k*2);
-        } else {
-          if (value <= 3) {
-            aux_value |= (value << k*2);
-          } else {
-            aux_value |= (((value - 4) % 3) << k*2);
-          }
-        }
-        LUT_position = (LUT_position + 1) % (((num_inputs - 2) / 3) + 1);
-      }
-      mux_t_frames[frame_address_position].value[j] = (mux_t_frames[frame_address_position].value[j] & (~frame_mask)) | aux_value;
+    num_segments = virtual_architecture->partition[x][y].element.fine_grain->num_mux_segments[mux_number];
+    mux_segment = virtual_architecture->partition[x][y].element.fine_grain->mux_segments[mux_number];
+    select_words = virtual_architecture->partition[x][y].element.fine_grain->mux_select_words[mux_number][value];
+    for (i = 0; i < num_segments; i++) {
+      frame = mux_t_frames[mux_segment[i].frame_address_position].value;
+      frame[mux_segment[i].word] = (frame[mux_segment[i].word] & (~mux_segment[i].mask)) | select_words[i];
+      set_mux_frame_dirty(mux_segment[i].frame_address_position);
     }
+    return XST_SUCCESS;
   }
 
-  void change_partition_FU(virtual_architecture_t *virtual_architecture, int x, int y, int FU_number, FU_functions_t value) {
-    int i;
-    int total_blocks_to_send, blocks_sent, first_block, last_block, blocks_to_send;
-    uint32_t frame_address_position;
+  int change_partition_FU(virtual_architecture_t *virtual_architecture, int x, int y, int FU_number, FU_functions_t value) {
+    int i, num_segments, slot;
+    fine_grain_segment_t *FU_segment;
+    uint32_t *block_pattern, *frame;
     
+    if (virtual_architecture->partition[x][y].element.fine_grain == NULL ||
+        FU_number < 0 || FU_number >= virtual_architecture->partition[x][y].element.element_info->num_FU) {
+      return XST_FAILURE;
+    }
     #if SEARCH_IF_FINE_GRAIN_VALUE_HAS_CHANGED == 1
-      int same_value = 1;
-
-      if (value != virtual_architecture->partition[x][y].element.FU_definition[FU_number].value) {
-       same_value = 0;
-       virtual_architecture->partition[x][y].element.FU_definition[FU_number].value = value;
+      // The FU already has that function
+      if (value == virtual_architecture->partition[x][y].element.fine_grain->FU_definition[FU_number].value &&
+          virtual_architecture->partition[x][y].element.fine_grain->FU_definition[FU_number].initialized == 1) {
+       return XST_SUCCESS;
       }
-
-      // The constant already has that value
-      if (same_value == 1 && virtual_architecture->partition[x][y].element.FU_definition[FU_number].initialized == 1) {
-       return;
-      }
-
-      virtual_architecture->partition[x][y].element.FU_definition[FU_number].initialized = 1;
     #endif
+    // Functions added at run time are loaded in the RE memory on demand
+    slot = get_FU_function_slot((int) value);
+    if (slot == -1) {
+      return XST_FAILURE;
+    }
+    #if SEARCH_IF_FINE_GRAIN_VALUE_HAS_CHANGED == 1
+      virtual_architecture->partition[x][y].element.fine_grain->FU_definition[FU_number].value = value;
+      virtual_architecture->partition[x][y].element.fine_grain->FU_definition[FU_number].initialized = 1;
+    #endif
+    virtual_architecture->partition[x][y].element.fine_grain->FU_definition[FU_number].slot = slot;
     
-    total_blocks_to_send = 2*virtual_architecture->partition[x][y].element.element_info->FU_4_bit_blocks[FU_number];
-    blocks_sent = 0;
-    i = 0;
-    while (total_blocks_to_send > blocks_sent) {
-      frame_address_position = virtual_architecture->partition[x][y].element.FU_frame_address_position[FU_number][i];
-      first_block = virtual_architecture->partition[x][y].element.first_FU_block_in_frame[FU_number][i];
-      last_block = virtual_architecture->partition[x][y].element.last_FU_block_in_frame[FU_number][i];
-      blocks_to_send = last_block + 1 - first_block;
-      change_FU_frame_address(frame_address_position, first_block, last_block, (int) value);
-      i++;
-      blocks_sent += blocks_to_send;
+    num_segments = virtual_architecture->partition[x][y].element.fine_grain->num_FU_segments[FU_number];
+    FU_segment = virtual_architecture->partition[x][y].element.fine_grain->FU_segments[FU_number];
+    block_pattern = virtual_architecture->partition[x][y].element.fine_grain->FU_block_pattern[FU_number];
+    for (i = 0; i < num_segments; i++) {
+      frame = FU_t_frames[FU_segment[i].frame_address_position].value;
+      // The 5-bit template number is copied to every block of the word
+      frame[FU_segment[i].word] = (frame[FU_segment[i].word] & (~FU_segment[i].mask)) | ((uint32_t) slot * block_pattern[i]);
+      set_FU_frame_dirty(FU_segment[i].frame_address_position);
     }
+    return XST_SUCCESS;
   }
 
   #define BITS_PER_BLOCK 	5
   #define BLOCK_PER_WORD    (32 / BITS_PER_BLOCK)
-  static void change_FU_frame_address(uint32_t frame_address_position, int first_block, int last_block, int value) {
-    uint32_t first_frame_word, first_frame_block, last_frame_word, last_frame_block, frame_mask;
-    uint32_t aux_value;
-    uint32_t j, k;
-    
-    FU_frames_flags[frame_address_position] = RECONFIGURE_FRAME;
-    
-    first_frame_word = first_block / BLOCK_PER_WORD;
-    last_frame_word = last_block / BLOCK_PER_WORD;
-    
-    for (j = first_frame_word; j <= last_frame_word; j++) {
-      if (j == first_frame_word) {
-        first_frame_block = (first_block % BLOCK_PER_WORD);
-      } else {
-        first_frame_block = 0;
-      }
-      if (j == last_frame_word) {
-        last_frame_block = (last_block % BLOCK_PER_WORD);
-      } else {
-        last_frame_block = BLOCK_PER_WORD-1;
+  /*
+  * Each 32-bit word contains the info of BLOCK_PER_WORD FU blocks. The info of
+  * the first block starts at bit 0. This way of storing the FU block 
+  * information uses more words but is faster to update.
+  */
+  static int calculate_FU_segments(fine_grain_layout_t *element, int FU_number, int frame_address_position, int first_block, int last_block) {
+    uint32_t first_frame_block, last_frame_block, j, k;
+    int num_segments;
+
+    num_segments = element->num_FU_segments[FU_number];
+    for (j = first_block / BLOCK_PER_WORD; j <= last_block / BLOCK_PER_WORD; j++) {
+      if (num_segments == MAX_FU_SEGMENT_WORDS) {
+        return -1;
       }
-      
-      aux_value = 0;
-      frame_mask = 0;
-      // Each 32-bit word contains the info of BLOCK_PER_WORD FU blocks. The info of the first block starts at bit 0.
-      // This way of storing the FU block information uses more words but is faster to update.
+      first_frame_block = (j == first_block / BLOCK_PER_WORD) ? first_block % BLOCK_PER_WORD : 0;
+      last_frame_block = (j == last_block / BLOCK_PER_WORD) ? last_block % BLOCK_PER_WORD : BLOCK_PER_WORD - 1;
+      element->FU_segments[FU_number][num_segments].frame_address_position = frame_address_position;
+      element->FU_segments[FU_number][num_segments].word = j;
+      element->FU_segments[FU_number][num_segments].mask = 0;
+      element->FU_block_pattern[FU_number][num_segments] = 0;
       for (k = first_frame_block; k <= last_frame_block; k++) {
-        frame_mask |= (0x1F << k*5);
-        aux_value |= value << k*5;
+        element->FU_segments[FU_number][num_segments].mask |= (0x1F << k*BITS_PER_BLOCK);
+        element->FU_block_pattern[FU_number][num_segments] |= (0x1 << k*BITS_PER_BLOCK);
       }
-      FU_t_frames[frame_address_position].value[j] = (FU_t_frames[frame_address_position].value[j] & (~frame_mask)) | aux_value;
+      num_segments++;
     }
+    element->num_FU_segments[FU_number] = num_segments;
+    return 0;
   }
 
 
@@ -1108,8 +1870,7 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
       if (is_column_CLB_type(row, column)) {
         if (CLB_columns == (column_number / 2)) {
           minor_column = obtain_CLB_minor_column(row, column, column_number % 2);
-          frame_address = PCAP_SetupFar7S (((fpga[row][column][0]>>24) & 0xFF), \
-          PCAP_FAR_CLB_BLOCK, ((fpga[row][column][0]>>16) & 0xFF), (column), minor_column);
+          frame_address = PCAP_SetupFarRow(PCAP_FAR_CLB_BLOCK, row, column, minor_column);
           return frame_address;
         }
         CLB_columns ++;
@@ -1121,12 +1882,12 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
   }
 
   static int is_column_CLB_type(int row, int column) {
-    return (fpga[row][column][1] == CLB_M_TYPE) || (fpga[row][column][1] == CLB_L_TYPE);
+    return (DEVICE_TYPE(row, column) == CLB_M_TYPE) || (DEVICE_TYPE(row, column) == CLB_L_TYPE);
   }
 
   static int obtain_CLB_minor_column(int row, int column, int num_slice) {
     int minor_column;
-    if (fpga[row][column][1] == CLB_L_TYPE) {
+    if (DEVICE_TYPE(row, column) == CLB_L_TYPE) {
       if (num_slice == 0) {
         // First slice
         minor_column = MINOR_COLUMN_SLICE_L_1;
@@ -1153,69 +1914,446 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
 
 
   /*
-  *
+  * All the dirty constant, mux and FU frames are collected in a single queue
+  * and streamed to the fine grain RE in one pass. The words of the next frame
+  * are only written once the RE has acknowledged the previous XFAR, so the data
+  * transfer overlaps with the reconfiguration of the previous frame and the RE
+  * is drained just once at the end.
   */
   void reconfigure_fine_grain() {
+    wait_fine_grain_commit(reconfigure_fine_grain_async());
+  }
+
+  uint32_t reconfigure_fine_grain_async() {
+    int i, j;
+
+    // Only one commit can be in flight
+    wait_fine_grain_commit(fine_grain_commits_started);
+
+    fine_grain_queue_length = 0;
+    fine_grain_queue_sent = 0;
     reconfigure_constants();
     reconfigure_muxes();
     reconfigure_FU();
+    for (i = 0; i < fine_grain_queue_length; i++) {
+      for (j = 0; j < fine_grain_queue[i].words; j++) {
+        fine_grain_inflight_words[i][j] = fine_grain_queue[i].value[j];
+      }
+      fine_grain_queue[i].value = fine_grain_inflight_words[i];
+      // Both routes overwrite the clock word of the frames, so the clock words
+      // stored by the relocation engine are no longer valid for the column
+      PCAP_invalidate_clock_words_frame(fine_grain_queue[i].xfar & XFAR_FRAME_ADDR_MASK);
+    }
+
+    #if FINE_GRAIN_PCAP_ROUTING
+      if (fine_grain_queue_length != 0 && write_fine_grain_queue_PCAP() == XST_SUCCESS) {
+        fine_grain_commits_started++;
+        finish_fine_grain_commit();
+        return fine_grain_commits_started;
+      }
+      fine_grain_commit_frames = count_fine_grain_queue_frames();
+      fine_grain_commit_timed = 1;
+      XTime_GetTime(&fine_grain_commit_start);
+    #endif
+    fine_grain_commits_started++;
+    if (fine_grain_queue_length != 0) {
+      enable_ICAP();
+    }
+    #if FINE_GRAIN_INTERRUPT
+      // The ISR sends the rest of the frames
+      if (send_fine_grain_queue() == 0) {
+        ICAP[ICAP_IRQ_REG] = (fine_grain_queue_sent < fine_grain_queue_length) ? ICAP_IRQ_ACK : ICAP_IRQ_READY;
+      }
+    #else
+      send_fine_grain_queue();
+    #endif
+    return fine_grain_commits_started;
   }
 
-  void reconfigure_constants() {
-    int i, j;
-    uint32_t xfar;
-    enable_ICAP();
-    for (i = 0; i < MAX_COLUMNS_CONSTANTS; i++) {
-      if (constant_frames_flags[i] == RECONFIGURE_FRAME) {
-        constant_frames_flags[i] = DO_NOT_RECONFIGURE_FRAME;
-        while (ICAP[0] & 0x1) { }  // wait for ack (mandatory)
-        for (j = 0; j < WORDS_PER_CONSTANTS; j++) {
-          ICAP[j+1] = constant_t_frames[i].value[j];
+  int fine_grain_commit_done(uint32_t commit) {
+    if ((int32_t) (fine_grain_commits_completed - commit) >= 0) {
+      return 1;
+    }
+    #if FINE_GRAIN_INTERRUPT
+      return 0;
+    #else
+      check_fine_grain_commit_timing();
+      return send_fine_grain_queue();
+    #endif
+  }
+
+  void set_fine_grain_commit_callback(fine_grain_commit_callback_t callback, void *callback_ref) {
+    fine_grain_commit_callback = callback;
+    fine_grain_commit_callback_ref = callback_ref;
+  }
+
+  #if FINE_GRAIN_INTERRUPT
+  int init_fine_grain_interrupt(XScuGic *gic) {
+    int status;
+    ICAP[ICAP_IRQ_REG] = 0;
+    XScuGic_SetPriorityTriggerType(gic, ICAP_INTR_ID, 0xA0, 0x1); // Level high
+    status = XScuGic_Connect(gic, ICAP_INTR_ID, (Xil_InterruptHandler) fine_grain_interrupt_handler, NULL);
+    if (status != XST_SUCCESS) {
+      return XST_FAILURE;
+    }
+    XScuGic_Enable(gic, ICAP_INTR_ID);
+    return XST_SUCCESS;
+  }
+
+  void fine_grain_interrupt_handler(void *callback_ref) {
+    if (send_fine_grain_queue() == 1) {
+      ICAP[ICAP_IRQ_REG] = 0;
+    } else if (fine_grain_queue_sent == fine_grain_queue_length) {
+      // Every frame has been written, wait for the RE to finish
+      ICAP[ICAP_IRQ_REG] = ICAP_IRQ_READY;
+    }
+  }
+  #endif
+
+  void wait_fine_grain_commit(uint32_t commit) {
+    #if FINE_GRAIN_INTERRUPT
+      while (fine_grain_commit_done(commit) == 0) { }
+    #else
+      // Once in the loop the RE is polled continuously, but it may have been
+      // idle before the wait started
+      if ((int32_t) (fine_grain_commits_completed - commit) < 0) {
+        check_fine_grain_commit_timing();
+      }
+      while ((int32_t) (fine_grain_commits_completed - commit) < 0 && send_fine_grain_queue() == 0) { }
+    #endif
+  }
+
+  #if !FINE_GRAIN_INTERRUPT
+  /*
+  * Without the interrupt the RE only gets new frames and its end is only seen
+  * while the CPU polls it. If the RE is idle when the CPU comes back to the
+  * commit, it has been waiting for an unknown time, so the commit is not used
+  * to estimate the RE cost.
+  */
+  static void check_fine_grain_commit_timing() {
+    #if FINE_GRAIN_PCAP_ROUTING
+      if (fine_grain_commits_completed != fine_grain_commits_started && ICAP[0] == 0) {
+        fine_grain_commit_timed = 0;
+      }
+    #endif
+  }
+  #endif
+
+  /*
+  * Each dirty frame is a separate RE command. They cannot be merged into
+  * multi-frame commands: the RE repeats the same cfg words in every frame of
+  * a command, and the fine-grain frames (minors 26, 32 and 34, and 27, 33 and
+  * 35 for the second FU frame) of a column are never adjacent.
+  */
+  static void queue_fine_grain_frame(uint32_t element_type, uint32_t num_frames, uint32_t frame_address, uint32_t *value, int words) {
+    fine_grain_queue[fine_grain_queue_length].xfar = obtain_XFAR(element_type, num_frames, frame_address);
+    fine_grain_queue[fine_grain_queue_length].value = value;
+    fine_grain_queue[fine_grain_queue_length].words = words;
+    fine_grain_queue_length++;
+  }
+
+  /*
+  * Sends the frames of the commit in flight while the RE accepts them. It
+  * returns 1 once every frame has been written and the RE is idle, or 0 if
+  * the RE is still busy. The RE cost is only sampled if the RE never waited
+  * for the CPU during the commit (see check_fine_grain_commit_timing).
+  */
+  static int send_fine_grain_queue() {
+    int j;
+    if (fine_grain_commits_completed == fine_grain_commits_started) {
+      return 1;
+    }
+    while (fine_grain_queue_sent < fine_grain_queue_length) {
+      if (ICAP[0] & 0x1) {
+        return 0; // the previous XFAR has not been acknowledged yet
+      }
+      for (j = 0; j < fine_grain_queue[fine_grain_queue_sent].words; j++) {
+        ICAP[j+1] = fine_grain_queue[fine_grain_queue_sent].value[j];
+      }
+      ICAP[0] = fine_grain_queue[fine_grain_queue_sent].xfar; // send XFAR and start reconfiguration!
+      fine_grain_queue_sent++;
+    }
+    if (fine_grain_queue_length != 0 && ICAP[0] != 0) {
+      return 0;
+    }
+    #if FINE_GRAIN_PCAP_ROUTING
+      if (fine_grain_queue_length != 0) {
+        XTime end;
+        XTime_GetTime(&end);
+        update_fine_grain_route_statistics(FINE_GRAIN_ROUTE_RE, fine_grain_commit_frames, 0, fine_grain_commit_timed, end - fine_grain_commit_start);
+      }
+    #endif
+    finish_fine_grain_commit();
+    return 1;
+  }
+
+  static void finish_fine_grain_commit() {
+    fine_grain_queue_length = 0;
+    fine_grain_queue_sent = 0;
+    fine_grain_commits_completed = fine_grain_commits_started;
+    if (fine_grain_commit_callback != NULL) {
+      fine_grain_commit_callback(fine_grain_commits_completed, fine_grain_commit_callback_ref);
+    }
+  }
+
+  #if FINE_GRAIN_PCAP_ROUTING
+  static void init_fine_grain_routing() {
+    memset(&fine_grain_route_statistics, 0, sizeof(fine_grain_route_statistics));
+    fine_grain_route_statistics.RE_ticks_per_frame = US_TO_TICKS(FINE_GRAIN_RE_FRAME_US);
+    fine_grain_route_statistics.PCAP_ticks_per_frame = US_TO_TICKS(FINE_GRAIN_PCAP_FRAME_US);
+    RE_memory_outdated = 1;
+  }
+
+  void get_fine_grain_route_statistics(fine_grain_route_statistics_t *statistics) {
+    *statistics = fine_grain_route_statistics;
+  }
+
+  static uint32_t count_fine_grain_queue_frames() {
+    int i;
+    uint32_t frames = 0;
+    for (i = 0; i < fine_grain_queue_length; i++) {
+      frames += XFAR_NUM_FRAMES(fine_grain_queue[i].xfar);
+    }
+    return frames;
+  }
+
+  // Runs of consecutive frame addresses are written with a single FAR and FDRI header
+  static int count_fine_grain_PCAP_runs() {
+    int i, num_runs = 0;
+    uint32_t next_frame_address = 0;
+    for (i = 0; i < fine_grain_queue_length; i++) {
+      if (num_runs == 0 || (fine_grain_queue[i].xfar & XFAR_FRAME_ADDR_MASK) != next_frame_address) {
+        num_runs++;
+      }
+      next_frame_address = (fine_grain_queue[i].xfar & XFAR_FRAME_ADDR_MASK) + XFAR_NUM_FRAMES(fine_grain_queue[i].xfar);
+    }
+    return num_runs;
+  }
+
+  /*
+  * Writes the queue through the PCAP if it is estimated to be faster than the
+  * RE. The frames are composed in software from a copy of the RE memory. It
+  * returns XST_FAILURE, leaving the queue for the RE, if the RE is estimated 
+  * to be faster or the PCAP fails.
+  */
+  static int write_fine_grain_queue_PCAP() {
+    int i, f, num_runs, position;
+    uint32_t frames, frame_address, RE_cost, PCAP_cost;
+    volatile uint32_t *mem = (volatile uint32_t*) ICAP_MEM_BASEADDR;
+    XTime start, end;
+
+    frames = count_fine_grain_queue_frames();
+    num_runs = count_fine_grain_PCAP_runs();
+    RE_cost = frames * fine_grain_route_statistics.RE_ticks_per_frame;
+    PCAP_cost = US_TO_TICKS(FINE_GRAIN_PCAP_COMMIT_US) + num_runs * US_TO_TICKS(FINE_GRAIN_PCAP_RUN_US) + frames * fine_grain_route_statistics.PCAP_ticks_per_frame;
+    if (PCAP_cost >= RE_cost) {
+      return XST_FAILURE;
+    }
+
+    XTime_GetTime(&start);
+    if (RE_memory_outdated) {
+      for (i = 0; i < RE_MEMORY_WORDS; i++) {
+        RE_memory[i] = mem[i];
+      }
+      RE_memory_outdated = 0;
+    }
+    num_runs = 0;
+    position = 0;
+    for (i = 0; i < fine_grain_queue_length; i++) {
+      frame_address = fine_grain_queue[i].xfar & XFAR_FRAME_ADDR_MASK;
+      if (num_runs == 0 || fine_grain_PCAP_far[num_runs - 1] + fine_grain_PCAP_num_frames[num_runs - 1] != frame_address) {
+        if (num_runs != 0) {
+          memset(fine_grain_PCAP_frames[position++], 0, sizeof(fine_grain_PCAP_frames[0])); // Padding frame
         }
-        xfar = obtain_XFAR(CONST_TYPE, 1, constant_t_frames[i].frame_address);
-        ICAP[0] = xfar; // send XFAR and start reconfiguration!
+        fine_grain_PCAP_far[num_runs] = frame_address;
+        fine_grain_PCAP_num_frames[num_runs] = 0;
+        num_runs++;
+      }
+      for (f = 0; f < XFAR_NUM_FRAMES(fine_grain_queue[i].xfar); f++) {
+        compose_fine_grain_frame(fine_grain_PCAP_frames[position++], XFAR_ELEMENT_TYPE(fine_grain_queue[i].xfar), fine_grain_queue[i].value, f);
+        fine_grain_PCAP_num_frames[num_runs - 1]++;
       }
     }
-    while (ICAP[0] != 0);
+    memset(fine_grain_PCAP_frames[position], 0, sizeof(fine_grain_PCAP_frames[0])); // Padding frame
+
+    enable_PCAP();
+    if (PCAP_write_frames(&xCAP_component, fine_grain_PCAP_far, fine_grain_PCAP_num_frames, num_runs, fine_grain_PCAP_frames[0]) != XST_SUCCESS) {
+      return XST_FAILURE;
+    }
+    XTime_GetTime(&end);
+    update_fine_grain_route_statistics(FINE_GRAIN_ROUTE_PCAP, frames, num_runs, 1, end - start);
+    return XST_SUCCESS;
+  }
+
+  // If the commit was not timed only the counters are updated
+  static void update_fine_grain_route_statistics(int route, uint32_t frames, int num_runs, int timed, XTime elapsed) {
+    XTime overhead;
+
+    if (route == FINE_GRAIN_ROUTE_RE) {
+      fine_grain_route_statistics.RE_commits++;
+      fine_grain_route_statistics.RE_frames += frames;
+      if (timed) {
+        fine_grain_route_statistics.RE_ticks_per_frame = (3 * fine_grain_route_statistics.RE_ticks_per_frame + elapsed / frames) / 4;
+      }
+    } else {
+      fine_grain_route_statistics.PCAP_commits++;
+      fine_grain_route_statistics.PCAP_frames += frames;
+      // Only the frame cost is measured, the headers keep their estimated cost
+      overhead = US_TO_TICKS(FINE_GRAIN_PCAP_COMMIT_US) + num_runs * US_TO_TICKS(FINE_GRAIN_PCAP_RUN_US);
+      if (timed && elapsed > overhead) {
+        fine_grain_route_statistics.PCAP_ticks_per_frame = (3 * fine_grain_route_statistics.PCAP_ticks_per_frame + (elapsed - overhead) / frames) / 4;
+      }
+    }
+    fine_grain_route_statistics.last_route = route;
+    fine_grain_route_statistics.last_frames = frames;
+    fine_grain_route_statistics.last_frames_per_second = (timed && elapsed != 0) ? (uint32_t) (((XTime) frames * COUNTS_PER_SECOND) / elapsed) : 0;
+  }
+  #endif
+
+  void reconfigure_constants() {
+    int i, slot;
+    for (i = 0; i < num_constant_dirty_frames; i++) {
+      slot = constant_dirty_frames[i];
+      constant_frames_flags[slot] = DO_NOT_RECONFIGURE_FRAME;
+      queue_fine_grain_frame(CONST_TYPE, 1, constant_t_frames[slot].frame_address, constant_t_frames[slot].value, WORDS_PER_CONSTANTS);
+    }
+    num_constant_dirty_frames = 0;
   }
 
   void reconfigure_muxes() {
-    int i, j;
-    uint32_t xfar;
-    enable_ICAP();
-    for (i = 0; i < MAX_COLUMNS_MUX; i++) {
-      if (mux_frames_flags[i] == RECONFIGURE_FRAME) {
-        mux_frames_flags[i] = DO_NOT_RECONFIGURE_FRAME;
-        while (ICAP[0] & 0x1) { }  // wait for ack (mandatory)
-        for (j = 0; j < WORDS_PER_MUX; j++) {
-          ICAP[j+1] = mux_t_frames[i].value[j];
+    int i, slot;
+    for (i = 0; i < num_mux_dirty_frames; i++) {
+      slot = mux_dirty_frames[i];
+      mux_frames_flags[slot] = DO_NOT_RECONFIGURE_FRAME;
+      queue_fine_grain_frame(MUX_TYPE, 1, mux_t_frames[slot].frame_address, mux_t_frames[slot].value, WORDS_PER_MUX);
+    }
+    num_mux_dirty_frames = 0;
+  }
+
+
+  void reconfigure_FU() {
+    int i, slot;
+    for (i = 0; i < num_FU_dirty_frames; i++) {
+      slot = FU_dirty_frames[i];
+      FU_frames_flags[slot] = DO_NOT_RECONFIGURE_FRAME;
+      queue_fine_grain_frame(FU_TYPE, 2, FU_t_frames[slot].frame_address, FU_t_frames[slot].value, WORDS_PER_FU);
+    }
+    num_FU_dirty_frames = 0;
+  }
+
+
+  #if FINE_GRAIN_SNAPSHOTS
+  static fine_grain_snapshot_t *find_fine_grain_snapshot(const char *name) {
+    int i;
+    for (i = 0; i < FINE_GRAIN_SNAPSHOTS; i++) {
+      if (fine_grain_snapshots[i].name[0] != '\0' && strncmp(fine_grain_snapshots[i].name, name, MAX_CHARS_PER_SNAPSHOT) == 0) {
+        return &fine_grain_snapshots[i];
+      }
+    }
+    return NULL;
+  }
+
+  int save_fine_grain_snapshot(virtual_architecture_t *virtual_architecture, const char *name) {
+    int i, x, y;
+    fine_grain_snapshot_t *snapshot;
+    fine_grain_layout_t *fine_grain;
+
+    if (name == NULL || name[0] == '\0') {
+      return XST_FAILURE;
+    }
+    snapshot = find_fine_grain_snapshot(name);
+    for (i = 0; i < FINE_GRAIN_SNAPSHOTS && snapshot == NULL; i++) {
+      if (fine_grain_snapshots[i].name[0] == '\0') {
+        snapshot = &fine_grain_snapshots[i];
+      }
+    }
+    if (snapshot == NULL) {
+      return XST_FAILURE;
+    }
+
+    strncpy(snapshot->name, name, MAX_CHARS_PER_SNAPSHOT - 1);
+    snapshot->name[MAX_CHARS_PER_SNAPSHOT - 1] = '\0';
+    memcpy(snapshot->constant_frames, constant_t_frames, sizeof(constant_t_frames));
+    memcpy(snapshot->mux_frames, mux_t_frames, sizeof(mux_t_frames));
+    memcpy(snapshot->FU_frames, FU_t_frames, sizeof(FU_t_frames));
+    for (x = 0; x < MAX_WIDTH_VIRTUAL_ARCHITECTURE; x++) {
+      for (y = 0; y < MAX_HEIGHT_VIRTUAL_ARCHITECTURE; y++) {
+        fine_grain = virtual_architecture->partition[x][y].element.fine_grain;
+        if (fine_grain == NULL) {
+          continue;
         }
-        xfar = obtain_XFAR(MUX_TYPE, 1, mux_t_frames[i].frame_address);
-        ICAP[0] = xfar; // send XFAR and start reconfiguration!
+        i = fine_grain - fine_grain_layouts;
+        memcpy(snapshot->constants_definition[i], fine_grain->constants_definition, sizeof(snapshot->constants_definition[i]));
+        memcpy(snapshot->mux_definition[i], fine_grain->mux_definition, sizeof(snapshot->mux_definition[i]));
+        memcpy(snapshot->FU_definition[i], fine_grain->FU_definition, sizeof(snapshot->FU_definition[i]));
       }
     }
-    while (ICAP[0] != 0);
+    return XST_SUCCESS;
   }
 
+  int apply_fine_grain_snapshot(virtual_architecture_t *virtual_architecture, const char *name) {
+    int i, x, y;
+    fine_grain_snapshot_t *snapshot;
+    fine_grain_layout_t *fine_grain;
 
-  void reconfigure_FU() {
-    int i, j;
-    uint32_t xfar;
-    enable_ICAP();
+    snapshot = find_fine_grain_snapshot(name);
+    if (snapshot == NULL) {
+      return XST_FAILURE;
+    }
+
+    // The frame images are only valid if the elements have not been moved or released
+    // (a released slot has no frame address until it is assigned again)
+    for (i = 0; i < MAX_COLUMNS_CONSTANTS; i++) {
+      if (snapshot->constant_frames[i].frame_address != constant_t_frames[i].frame_address) {
+        return XST_FAILURE;
+      }
+    }
+    for (i = 0; i < MAX_COLUMNS_MUX; i++) {
+      if (snapshot->mux_frames[i].frame_address != mux_t_frames[i].frame_address) {
+        return XST_FAILURE;
+      }
+    }
+    for (i = 0; i < MAX_COLUMNS_FU; i++) {
+      if (snapshot->FU_frames[i].frame_address != FU_t_frames[i].frame_address) {
+        return XST_FAILURE;
+      }
+    }
+
+    for (i = 0; i < MAX_COLUMNS_CONSTANTS; i++) {
+      if (memcmp(snapshot->constant_frames[i].value, constant_t_frames[i].value, sizeof(constant_t_frames[i].value)) != 0) {
+        memcpy(constant_t_frames[i].value, snapshot->constant_frames[i].value, sizeof(constant_t_frames[i].value));
+        set_constant_frame_dirty(i);
+      }
+    }
+    for (i = 0; i < MAX_COLUMNS_MUX; i++) {
+      if (memcmp(snapshot->mux_frames[i].value, mux_t_frames[i].value, sizeof(mux_t_frames[i].value)) != 0) {
+        memcpy(mux_t_frames[i].value, snapshot->mux_frames[i].value, sizeof(mux_t_frames[i].value));
+        set_mux_frame_dirty(i);
+      }
+    }
     for (i = 0; i < MAX_COLUMNS_FU; i++) {
-      if (FU_frames_flags[i] == RECONFIGURE_FRAME) {
-        FU_frames_flags[i] = DO_NOT_RECONFIGURE_FRAME;
-        while (ICAP[0] & 0x1) { }  // wait for ack (mandatory)
-        for (j = 0; j < WORDS_PER_FU; j++) {
-          ICAP[j+1] = FU_t_frames[i].value[j];
+      if (memcmp(snapshot->FU_frames[i].value, FU_t_frames[i].value, sizeof(FU_t_frames[i].value)) != 0) {
+        memcpy(FU_t_frames[i].value, snapshot->FU_frames[i].value, sizeof(FU_t_frames[i].value));
+        set_FU_frame_dirty(i);
+      }
+    }
+    for (x = 0; x < MAX_WIDTH_VIRTUAL_ARCHITECTURE; x++) {
+      for (y = 0; y < MAX_HEIGHT_VIRTUAL_ARCHITECTURE; y++) {
+        fine_grain = virtual_architecture->partition[x][y].element.fine_grain;
+        if (fine_grain == NULL) {
+          continue;
         }
-        xfar = obtain_XFAR(FU_TYPE, 2, FU_t_frames[i].frame_address);
-        ICAP[0] = xfar; // send XFAR and start reconfiguration!
+        i = fine_grain - fine_grain_layouts;
+        memcpy(fine_grain->constants_definition, snapshot->constants_definition[i], sizeof(snapshot->constants_definition[i]));
+        memcpy(fine_grain->mux_definition, snapshot->mux_definition[i], sizeof(snapshot->mux_definition[i]));
+        memcpy(fine_grain->FU_definition, snapshot->FU_definition[i], sizeof(snapshot->FU_definition[i]));
       }
     }
-    while (ICAP[0] != 0);
-  }
 
+    reconfigure_fine_grain();
+    return XST_SUCCESS;
+  }
+  #endif
 
   void load_fine_grain_PBS() {
     load_constant_PBS();
@@ -1309,8 +2447,6 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
   #define FUNC(a,b, noovf,ovf)  { ADD((a), (b)),  SAT((noovf), (ovf)) }
 
 
-  #define NUM_FU_FUNCTIONS 18
-
   //IN1_S1 --> first operand
   //IN2_S1 --> second operand
   static const uint32_t lut_functions[NUM_FU_FUNCTIONS][2] = {
@@ -1341,30 +2477,193 @@ static void update_partition_location_info(virtual_architecture_t *virtual_archi
   #define PE_SIZE			 8
   #define FU_MEM_BASE_ADDR (ICAP_MEM_BASEADDR + OFFSET_FU_PBS)
   void load_FU() {
-    volatile uint32_t (*PE_ADDR)[PE_SIZE] = (volatile uint32_t (*)[PE_SIZE]) FU_MEM_BASE_ADDR;
     int i;
-    for (i=0; i<NUM_FU_FUNCTIONS; i++) {
-      uint32_t f1_stage1, f2_stage1, f1_stage2, f2_stage2; //Estos son los frames 1 y 2.
-      
-      // Stage 1 (2 frames; ABOVE stage 2)
-      f1_stage1 = f2_stage1 = lut_functions[i][0];
-      f1_stage1 = f1_stage1 >> 16;    // frame 1
-      f2_stage1 = f2_stage1 & 0xFFFF; // frame 2
+    for (i = 0; i < FU_FUNCTION_SLOTS; i++) {
+      if (i < NUM_FU_FUNCTIONS) {
+        write_FU_function(i, lut_functions[i][0], lut_functions[i][1]);
+        FU_slot_function[i] = i;
+      } else {
+        FU_slot_function[i] = -1;
+      }
+      FU_slot_last_use[i] = 0;
+    }
+    for (i = 0; i < MAX_FU_USER_FUNCTIONS; i++) {
+      FU_user_functions[i].registered = 0;
+    }
+    FU_slot_uses = 0;
+  }
 
+  static void write_FU_function(int slot, uint32_t stage1_LUT, uint32_t stage2_LUT) {
+    volatile uint32_t (*PE_ADDR)[PE_SIZE] = (volatile uint32_t (*)[PE_SIZE]) FU_MEM_BASE_ADDR;
+    uint32_t f1_stage1, f2_stage1, f1_stage2, f2_stage2; //Estos son los frames 1 y 2.
+    int j;
+    
+    // Stage 1 (2 frames; ABOVE stage 2)
+    f1_stage1 = stage1_LUT >> 16;    // frame 1
+    f2_stage1 = stage1_LUT & 0xFFFF; // frame 2
 
-      // Stage 2 (2 frames; BELOW stage 1)
-      f1_stage2 = f2_stage2 = lut_functions[i][1];
-      f1_stage2 = f1_stage2 >> 16;    // frame 1
-      f2_stage2 = f2_stage2 & 0xFFFF; // frame 2
-      
-      for (int j=0; j<2; j++) {
-    	  PE_ADDR[i][j] = f1_stage2<<16 | f1_stage1;
+    // Stage 2 (2 frames; BELOW stage 1)
+    f1_stage2 = stage2_LUT >> 16;    // frame 1
+    f2_stage2 = stage2_LUT & 0xFFFF; // frame 2
+    
+    for (j=0; j<2; j++) {
+      PE_ADDR[slot][j] = f1_stage2<<16 | f1_stage1;
+    }
+    for (j=4; j<6; j++) {
+      PE_ADDR[slot][j] = f2_stage2<<16 | f2_stage1;
+    }
+    #if FINE_GRAIN_PCAP_ROUTING
+      RE_memory_outdated = 1;
+    #endif
+  }
+
+  #if FINE_GRAIN_PCAP_ROUTING
+  /*
+  * Builds the frame that the RE writes for a command. Every word but the clock
+  * word is the template of the RE memory selected by the cfg value of its 
+  * element (one word per constant or mux element, two per FU block).
+  */
+  static void compose_fine_grain_frame(uint32_t *frame, uint32_t element_type, const uint32_t *cfg, int frame_number) {
+    int i, element, block;
+    uint32_t cfg_value;
+    for (i = 0; i < FINE_GRAIN_FRAME_WORDS; i++) {
+      if (i == FINE_GRAIN_CLOCK_WORD) {
+        frame[i] = RE_memory[0]; // The RE writes the word of address 0
+        continue;
       }
-      for (int j=4; j<6; j++) {
-		  PE_ADDR[i][j] = f2_stage2<<16 | f2_stage1;
+      element = (i < FINE_GRAIN_CLOCK_WORD) ? i : i - 1;
+      if (element_type == FU_TYPE) {
+        block = element / 2;
+        cfg_value = (cfg[block / BLOCK_PER_WORD] >> ((block % BLOCK_PER_WORD) * BITS_PER_BLOCK)) & 0x1F;
+        frame[i] = RE_memory[OFFSET_FU_PBS / 4 + cfg_value * PE_SIZE + frame_number * 4 + element % 2];
+      } else {
+        cfg_value = (cfg[element / 8] >> ((element % 8) * BITS_CONSTANT_PBS)) & 0xF;
+        frame[i] = RE_memory[((element_type == MUX_TYPE) ? OFFSET_MUX_PBS : 0) + cfg_value];
       }
     }
+  }
+  #endif
+
+  int register_FU_function(uint32_t stage1_LUT, uint32_t stage2_LUT) {
+    int i, free_function = -1;
+    for (i = 0; i < MAX_FU_USER_FUNCTIONS; i++) {
+      if (FU_user_functions[i].registered == 0) {
+        if (free_function == -1) {
+          free_function = i;
+        }
+      } else if (FU_user_functions[i].lut[0] == stage1_LUT && FU_user_functions[i].lut[1] == stage2_LUT) {
+        return NUM_FU_FUNCTIONS + i;
+      }
+    }
+    if (free_function == -1) {
+      return -1;
+    }
+    FU_user_functions[free_function].registered = 1;
+    FU_user_functions[free_function].lut[0] = stage1_LUT;
+    FU_user_functions[free_function].lut[1] = stage2_LUT;
+    FU_user_functions[free_function].slot = -1;
+    return NUM_FU_FUNCTIONS + free_function;
+  }
+
+  int unregister_FU_function(int function) {
+    FU_user_function_t *user_function;
     
+    if (function < NUM_FU_FUNCTIONS || function >= NUM_FU_FUNCTIONS + MAX_FU_USER_FUNCTIONS) {
+      return XST_FAILURE;
+    }
+    user_function = &FU_user_functions[function - NUM_FU_FUNCTIONS];
+    if (user_function->registered == 0) {
+      return XST_FAILURE;
+    }
+    if (user_function->slot != -1) {
+      if (is_FU_slot_in_use(user_function->slot)) {
+        return XST_FAILURE;
+      }
+      FU_slot_function[user_function->slot] = -1;
+    }
+    user_function->registered = 0;
+    return XST_SUCCESS;
+  }
+
+  /*
+  * Returns the RE memory template of a function. A registered function that
+  * is not loaded is written in a free template or, if there is none, in the
+  * least recently used template that no FU selects.
+  */
+  static int get_FU_function_slot(int function) {
+    FU_user_function_t *user_function;
+    int i, slot;
+    
+    if (function < 0 || function >= NUM_FU_FUNCTIONS + MAX_FU_USER_FUNCTIONS) {
+      return -1;
+    } else if (function < NUM_FU_FUNCTIONS) {
+      return function;
+    }
+    user_function = &FU_user_functions[function - NUM_FU_FUNCTIONS];
+    if (user_function->registered == 0) {
+      return -1;
+    }
+    
+    if (user_function->slot == -1) {
+      slot = -1;
+      for (i = NUM_FU_FUNCTIONS; i < FU_FUNCTION_SLOTS; i++) {
+        if (FU_slot_function[i] == -1) {
+          slot = i;
+          break;
+        }
+        if (!is_FU_slot_in_use(i) && (slot == -1 || FU_slot_last_use[i] < FU_slot_last_use[slot])) {
+          slot = i;
+        }
+      }
+      if (slot == -1) {
+        return -1;
+      }
+      if (FU_slot_function[slot] != -1) {
+        FU_user_functions[FU_slot_function[slot] - NUM_FU_FUNCTIONS].slot = -1;
+      }
+      // The RE reads the templates while it writes the frames
+      wait_fine_grain_commit(fine_grain_commits_started);
+      write_FU_function(slot, user_function->lut[0], user_function->lut[1]);
+      FU_slot_function[slot] = function;
+      user_function->slot = slot;
+    }
+    FU_slot_last_use[user_function->slot] = ++FU_slot_uses;
+    return user_function->slot;
+  }
+
+  /*
+  * A template is in use while an FU or a saved snapshot selects it. Templates
+  * are only replaced when a new function has to be loaded, so the FU 
+  * definitions are scanned instead of keeping reference counts.
+  */
+  static int is_FU_slot_in_use(int slot) {
+    int i, j;
+    for (i = 0; i < num_fine_grain_layouts; i++) {
+      if (!fine_grain_layouts[i].in_use) {
+        continue;
+      }
+      for (j = 0; j < MAX_FU; j++) {
+        if (fine_grain_layouts[i].FU_definition[j].slot == slot) {
+          return 1;
+        }
+      }
+    }
+    #if FINE_GRAIN_SNAPSHOTS
+      int k;
+      for (k = 0; k < FINE_GRAIN_SNAPSHOTS; k++) {
+        if (fine_grain_snapshots[k].name[0] == '\0') {
+          continue;
+        }
+        for (i = 0; i < MAX_FINE_GRAIN_PARTITIONS; i++) {
+          for (j = 0; j < MAX_FU; j++) {
+            if (fine_grain_snapshots[k].FU_definition[i][j].slot == slot) {
+              return 1;
+            }
+          }
+        }
+      }
+    #endif
+    return 0;
   }
 
 #endif
@@ -4,27 +4,47 @@
 #include <stdint.h> 
 #include "xil_types.h"
 #include "IMPRESS_reconfiguration_parameters.h"
+#if PBS_CACHE
+#include "PBS_cache.h"
+#endif
+#if PBS_STORE
+#include "PBS_store.h"
+#endif
+#if FINE_GRAIN && FINE_GRAIN_INTERRUPT
+#include "xscugic.h"
+#endif
 
 #define MAX_WORDS_PER_CONSTANT          (((MAX_BITS_PER_CONSTANT - 1) / 32) + 1)
 #define PREDEFINED_NUM_COLUMNS          0
 #define PREDEFINED_OFFSET_COLUMN        0
 #define MAX_CHARS_PER_PBS               50
+#define MAX_CHARS_PER_SNAPSHOT          16
+#define MAX_CONSTANT_SCATTER_OPS        (2 * MAX_WORDS_PER_CONSTANT + 2 * MAX_COLUMNS_CONSTANT_PER_ELEMENT)
+#define MAX_MUX_ENCODING_WORDS          (13 * MAX_COLUMNS_MUX_PER_ELEMENT) // 13 words hold the 200 LUT selects of a mux frame
+#define MAX_FU_SEGMENT_WORDS            (10 * MAX_COLUMNS_FU_PER_ELEMENT) // 10 words hold the 50 FU blocks of a frame
 
 #if FINE_GRAIN
-	#if MAX_COLUMNS_CONSTANTS > 1
-		#define MAX_COLUMNS_CONSTANT_PER_ELEMENT 2
+	// Frames (2 columns in each clock region row) that a component can use
+	#if MAX_COLUMNS_CONSTANTS > 2 * MAX_CLOCK_ROWS_PER_ELEMENT
+		#define MAX_COLUMNS_CONSTANT_PER_ELEMENT (2 * MAX_CLOCK_ROWS_PER_ELEMENT)
+	#elif MAX_COLUMNS_CONSTANTS > 1
+		#define MAX_COLUMNS_CONSTANT_PER_ELEMENT MAX_COLUMNS_CONSTANTS
 	#else
 		#define MAX_COLUMNS_CONSTANT_PER_ELEMENT 1
 	#endif
 
-	#if MAX_COLUMNS_MUX > 1
-		#define MAX_COLUMNS_MUX_PER_ELEMENT 2
+	#if MAX_COLUMNS_MUX > 2 * MAX_CLOCK_ROWS_PER_ELEMENT
+		#define MAX_COLUMNS_MUX_PER_ELEMENT (2 * MAX_CLOCK_ROWS_PER_ELEMENT)
+	#elif MAX_COLUMNS_MUX > 1
+		#define MAX_COLUMNS_MUX_PER_ELEMENT MAX_COLUMNS_MUX
 	#else
 		#define MAX_COLUMNS_MUX_PER_ELEMENT 1
 	#endif
 
-	#if MAX_COLUMNS_FU > 1
-		#define MAX_COLUMNS_FU_PER_ELEMENT 2
+	#if MAX_COLUMNS_FU > 2 * MAX_CLOCK_ROWS_PER_ELEMENT
+		#define MAX_COLUMNS_FU_PER_ELEMENT (2 * MAX_CLOCK_ROWS_PER_ELEMENT)
+	#elif MAX_COLUMNS_FU > 1
+		#define MAX_COLUMNS_FU_PER_ELEMENT MAX_COLUMNS_FU
 	#else
 		#define MAX_COLUMNS_FU_PER_ELEMENT 1
 	#endif
@@ -54,7 +74,7 @@
  * */
 
 // NOTE: more functions can be implemented however they are not important for mapping LLVM IR onto an overlay, therefore they are not included.
-// TODO: ver si poner mas funciones como mux por ejemplo o operaciones lógicas de 3 valores o de 2 con uno de sus operandos negados o smaller o bigger sin equal añadiendole el Cin
+// Other functions can be added at run time with register_FU_function().
 typedef enum  {	    add,
 					add_sat,
 					subtract,
@@ -82,6 +102,24 @@ typedef enum  {	    add,
     uint32_t value[MAX_WORDS_PER_CONSTANT];
   } constant_t;
 
+  // Moves the bits of one word of a constant to one word of a frame: 
+  // frame[dst_word] = (frame[dst_word] & ~mask) | ((value[src_word] << shift) & mask)
+  // A negative shift is a right shift.
+  typedef struct {
+    uint16_t frame_address_position;
+    uint8_t src_word;
+    uint8_t dst_word;
+    int8_t shift;
+    uint32_t mask;
+  } constant_scatter_t;
+
+  // Bits of a frame word that belong to a mux or FU
+  typedef struct {
+    uint16_t frame_address_position;
+    uint8_t word;
+    uint32_t mask;
+  } fine_grain_segment_t;
+
   typedef struct {
 	int initialized;
 	int value;
@@ -90,7 +128,28 @@ typedef enum  {	    add,
   typedef struct {
 	int initialized;
 	FU_functions_t value;
+	int slot; // RE memory template selected by the FU (-1 if unknown)
   } FU_t;
+
+  typedef void (*fine_grain_commit_callback_t)(uint32_t commit, void *callback_ref);
+
+  #if FINE_GRAIN_PCAP_ROUTING
+    #define FINE_GRAIN_ROUTE_RE       0
+    #define FINE_GRAIN_ROUTE_PCAP     1
+
+    // Costs are measured in XTime ticks (COUNTS_PER_SECOND)
+    typedef struct {
+      uint32_t RE_commits;            // Commits written by the ICAP RE
+      uint32_t PCAP_commits;          // Commits composed in software and written through the PCAP
+      uint32_t RE_frames;
+      uint32_t PCAP_frames;
+      uint32_t RE_ticks_per_frame;    // Estimated cost of a frame written by the RE
+      uint32_t PCAP_ticks_per_frame;  // Estimated cost of a frame composed and written through the PCAP
+      int last_route;                 // FINE_GRAIN_ROUTE_RE or FINE_GRAIN_ROUTE_PCAP
+      uint32_t last_frames;           // Frames of the last commit
+      uint32_t last_frames_per_second;// Frames per second achieved by the last commit (0 if it was not timed)
+    } fine_grain_route_statistics_t;
+  #endif
 #endif
 
 typedef struct {
@@ -113,24 +172,40 @@ typedef struct {
   #endif 
   char PBS_name[MAX_CHARS_PER_PBS]; // Contains the name of the PBS wich represents the element 
   int size[2]; //Width, Height
+  #if PARTITION_ALLOCATOR
+    // Position (X, Y) where the PBS was implemented. The allocator only places
+    // the element where the column types match the ones found there
+    int origin[2];
+  #endif
 } element_info_t;
 
-typedef struct {
-  #if FINE_GRAIN
+#if FINE_GRAIN
+  // Fine-grain state of a partition. It is only allocated for the partitions 
+  // that hold an element with fine-grain components.
+  typedef struct {
+    int in_use; // The layout belongs to a partition (otherwise it is in the free list)
     constant_t constants_definition[MAX_CONSTANTS]; // Fill the number of constants
     mux_t mux_definition[MAX_MUXES]; // Fill the number of muxes
-	  FU_t FU_definition[MAX_FU];
-    int constant_frame_address_position[MAX_CONSTANTS][MAX_COLUMNS_CONSTANT_PER_ELEMENT];
-  	int first_bit_in_frame[MAX_CONSTANTS][MAX_COLUMNS_CONSTANT_PER_ELEMENT];
-  	int last_bit_in_frame[MAX_CONSTANTS][MAX_COLUMNS_CONSTANT_PER_ELEMENT];
-  	int mux_frame_address_position[MAX_MUXES][MAX_COLUMNS_MUX_PER_ELEMENT];
-  	int first_LUT_in_frame[MAX_MUXES][MAX_COLUMNS_MUX_PER_ELEMENT];
-  	int last_LUT_in_frame[MAX_MUXES][MAX_COLUMNS_MUX_PER_ELEMENT];
-  	int LUT_position_in_frame[MAX_MUXES][MAX_COLUMNS_MUX_PER_ELEMENT];
-  	int total_LUTs_in_mux[MAX_MUXES];
-  	int FU_frame_address_position[MAX_FU][MAX_COLUMNS_FU_PER_ELEMENT];
-  	int first_FU_block_in_frame[MAX_FU][MAX_COLUMNS_FU_PER_ELEMENT];
-  	int last_FU_block_in_frame[MAX_FU][MAX_COLUMNS_FU_PER_ELEMENT];
+    FU_t FU_definition[MAX_FU];
+    constant_scatter_t constant_scatter[MAX_CONSTANTS][MAX_CONSTANT_SCATTER_OPS];
+    int num_constant_scatter_ops[MAX_CONSTANTS];
+    fine_grain_segment_t mux_segments[MAX_MUXES][MAX_MUX_ENCODING_WORDS];
+    uint32_t mux_select_words[MAX_MUXES][MAX_MUX_INPUTS][MAX_MUX_ENCODING_WORDS]; // Contents of each segment for every select value
+    int num_mux_segments[MAX_MUXES];
+    fine_grain_segment_t FU_segments[MAX_FU][MAX_FU_SEGMENT_WORDS];
+    uint32_t FU_block_pattern[MAX_FU][MAX_FU_SEGMENT_WORDS]; // Bit 0 of each FU block of the segment
+    int num_FU_segments[MAX_FU];
+    // Frame slots referenced by the layout (released when the layout is torn down)
+    uint16_t constant_slots[MAX_COLUMNS_CONSTANTS];
+    uint16_t mux_slots[MAX_COLUMNS_MUX];
+    uint16_t FU_slots[MAX_COLUMNS_FU];
+    int num_constant_slots, num_mux_slots, num_FU_slots;
+  } fine_grain_layout_t;
+#endif
+
+typedef struct {
+  #if FINE_GRAIN
+    fine_grain_layout_t *fine_grain; // NULL until a fine-grain element is placed
   #endif 
   element_info_t *element_info;
 } element_t;
@@ -147,6 +222,9 @@ typedef struct {
   // Position of the element (down-left corner) contains X and Y position respectively 
   int position[2]; //X, Y   
   location_info_t location_info;
+  #if PARTITION_ALLOCATOR
+    element_info_t *allocated_element; // Element the partition is reserved for by the allocator (NULL if free)
+  #endif
 } partition_t;
 
 typedef struct {
@@ -183,10 +261,10 @@ void init_virtual_architecture();
 * @param y: y coordinate of the virtual architecture matrix 
 * @param position_x: x FPGA coordinate
 * @param position_y: x FPGA coordinate
-* @return   none
+* @return   XST_SUCCESS or XST_FAILURE if the position is outside the FPGA
 *
 *****************************************************************************/
-void change_partition_position(virtual_architecture_t *virtual_architecture, int x, int y, int position_x, int position_y);
+int change_partition_position(virtual_architecture_t *virtual_architecture, int x, int y, int position_x, int position_y);
 /****************************************************************************/
 /**
 *
@@ -203,7 +281,8 @@ void change_partition_position(virtual_architecture_t *virtual_architecture, int
 * @param num_element: reconfigurable module position in elements variable
 *
 * @return  XST_SUCCESS or XST_FAILURE if the reconfigurable module could 
-*           not be reconfigured correctly
+*           not be reconfigured correctly. If its fine-grain components do
+*           not fit, the PBS is not written and the partition is invalidated
 *
 *****************************************************************************/
 int change_partition_element(virtual_architecture_t *virtual_architecture, int x, int y, int num_element);
@@ -226,6 +305,69 @@ int change_partition_element(virtual_architecture_t *virtual_architecture, int x
 *
 *****************************************************************************/
 
+#if PBS_PREFETCH
+  /****************************************************************************/
+  /**
+  *
+  * Loads in the PBS cache the element that is most likely to be reconfigured
+  * next in any partition of the virtual architecture. The prediction of each
+  * partition is the element that has most often followed its current one in
+  * the past (in any partition). This function should be called when the 
+  * processor and the SD card are idle. At most one PBS is loaded in each call
+  * and each prediction is only prefetched once until the partition is 
+  * reconfigured again. A prefetch never evicts the PBS predicted for another 
+  * partition or a prefetched PBS that has not been used yet.
+  *
+  * @param virtual_architecture:
+  *
+  * @return  1 if a PBS has been prefetched, 0 if there was nothing to prefetch
+  *          and -1 if the PBS could not be loaded
+  *
+  *****************************************************************************/
+  int prefetch_partition_PBS(virtual_architecture_t *virtual_architecture);
+#endif
+
+#if PARTITION_ALLOCATOR
+  /****************************************************************************/
+  /**
+  *
+  * Reserves a free partition of the virtual architecture for an element and
+  * places it in the reconfigurable area (PARTITION_ALLOCATOR_X0..YF). The
+  * positions are tried bottom-left first, only keeping the clock region row
+  * alignment of the element origin and the positions where the column types
+  * of every clock region row match the ones of the origin. The position must
+  * not overlap any other partition holding or reserved for an element. The
+  * element is not reconfigured: change_partition_element has to be called
+  * afterwards with the same element.
+  *
+  * @param virtual_architecture:
+  * @param num_element: reconfigurable module position in elements variable
+  * @param x: returns the x coordinate of the virtual architecture matrix
+  * @param y: returns the y coordinate of the virtual architecture matrix
+  *
+  * @return  XST_SUCCESS or XST_FAILURE if the element does not exist, there
+  *          is no free partition or no legal position for the element
+  *
+  *****************************************************************************/
+  int allocate_partition(virtual_architecture_t *virtual_architecture, int num_element, int *x, int *y);
+  /****************************************************************************/
+  /**
+  *
+  * Releases a partition reserved with allocate_partition. The partition is
+  * invalidated, its fine-grain layout and frame slots are freed and its region
+  * can be used by other elements.
+  *
+  * @param virtual_architecture:
+  * @param x: x coordinate of the virtual architecture matrix
+  * @param y: y coordinate of the virtual architecture matrix
+  *
+  * @return  XST_SUCCESS or XST_FAILURE if the partition does not exist or was
+  *          not allocated
+  *
+  *****************************************************************************/
+  int release_partition(virtual_architecture_t *virtual_architecture, int x, int y);
+#endif
+
 #if FINE_GRAIN
   /****************************************************************************/
   /**
@@ -239,10 +381,11 @@ int change_partition_element(virtual_architecture_t *virtual_architecture, int x
   * @param y: y coordinate of the virtual architecture matrix 
   * @param num_element: reconfigurable module position in elements variable
   *
-  * @return   none
+  * @return   XST_SUCCESS or XST_FAILURE if the element does not exist or its
+  *           fine-grain components could not be placed
   *
   *****************************************************************************/
-  void add_fine_grain_static_region(virtual_architecture_t *virtual_architecture, int x, int y, int element_info);
+  int add_fine_grain_static_region(virtual_architecture_t *virtual_architecture, int x, int y, int element_info);
   /****************************************************************************/
   /**
   *
@@ -260,10 +403,11 @@ int change_partition_element(virtual_architecture_t *virtual_architecture, int x
   * @param value[MAX_WORDS_PER_CONSTANT] pointer to a vector that contains the 
   *        new value of the constant. If the constant has 32 or less bits, this
   *        variable is a pointer to an uint32_t variable.
-  * @return   none
+  * @return   XST_SUCCESS or XST_FAILURE if the partition has no fine-grain 
+  *           components or the constant does not exist
   *
   *****************************************************************************/
-  void change_partition_constant(virtual_architecture_t *virtual_architecture, int x, int y, int constant_number, uint32_t value[MAX_WORDS_PER_CONSTANT]);
+  int change_partition_constant(virtual_architecture_t *virtual_architecture, int x, int y, int constant_number, uint32_t value[MAX_WORDS_PER_CONSTANT]);
   /****************************************************************************/
   /**
   *
@@ -278,11 +422,14 @@ int change_partition_element(virtual_architecture_t *virtual_architecture, int x
   * @param y: y coordinate of the virtual architecture matrix 
   * @param mux_number: position of the multiplexor to change as represented in 
   * the element variable 
-  * @param value: input that will be selected 
-  * @return   none
+  * @param value: input that will be selected (from 0 to the number of inputs 
+  *        of the multiplexor - 1)
+  * @return   XST_SUCCESS or XST_FAILURE if the partition has no fine-grain 
+  *           components, the multiplexor does not exist or the input is out
+  *           of range
   *
   *****************************************************************************/
-  void change_partition_mux(virtual_architecture_t *virtual_architecture, int x, int y, int mux_number, int value);
+  int change_partition_mux(virtual_architecture_t *virtual_architecture, int x, int y, int mux_number, int value);
   /****************************************************************************/
   /**
   *
@@ -298,10 +445,43 @@ int change_partition_element(virtual_architecture_t *virtual_architecture, int x
   * @param FU_number: position of the FU to change as represented in 
   * the element variable 
   * @param value: new functionality of the FU
-  * @return   none
+  * @return   XST_SUCCESS or XST_FAILURE if the partition has no fine-grain 
+  *           components, the FU does not exist or the function is not 
+  *           registered or cannot be loaded in the RE memory. The FU keeps
+  *           its previous function when it fails
+  *
+  *****************************************************************************/
+  int change_partition_FU(virtual_architecture_t *virtual_architecture, int x, int y, int FU_number, FU_functions_t value);
+  /****************************************************************************/
+  /**
+  *
+  * Registers a new FU function. The function is defined by the truth tables 
+  * of the two LUT stages of the FU, with the same format as the predefined 
+  * functions (see lut_functions[] in IMPRESS_reconfiguration.c). The truth 
+  * tables are loaded into a free template of the ICAP RE memory the first 
+  * time an FU uses the function. When all the templates are full, the least 
+  * recently used template that is not selected by any FU (or saved snapshot)
+  * is reused.
+  *
+  * @param stage1_LUT: truth table of the first stage 
+  * @param stage2_LUT: truth table of the second stage
+  * @return   value to pass to change_partition_FU() or -1 if the registry is 
+  * full
   *
   *****************************************************************************/
-  void change_partition_FU(virtual_architecture_t *virtual_architecture, int x, int y, int FU_number, FU_functions_t value);
+  int register_FU_function(uint32_t stage1_LUT, uint32_t stage2_LUT);
+  /****************************************************************************/
+  /**
+  *
+  * Removes a function added with register_FU_function() and frees its RE 
+  * memory template.
+  *
+  * @param function: value returned by register_FU_function()
+  * @return   XST_SUCCESS or XST_FAILURE if the function is not registered or
+  * an FU still uses it
+  *
+  *****************************************************************************/
+  int unregister_FU_function(int function);
   /****************************************************************************/
   /**
   *
@@ -312,6 +492,125 @@ int change_partition_element(virtual_architecture_t *virtual_architecture, int x
   *
   *****************************************************************************/
   void reconfigure_fine_grain();
+  /****************************************************************************/
+  /**
+  *
+  * Non-blocking version of reconfigure_fine_grain(). The updated frames are 
+  * copied to an in-flight buffer and their reconfiguration is started, so the
+  * fine-grain components can be changed again for the next commit while it 
+  * is in progress. The commit advances each time fine_grain_commit_done() is 
+  * called. If a previous commit is still in flight this function waits for it.
+  * With FINE_GRAIN_PCAP_ROUTING, a commit that is estimated to be faster 
+  * through the PCAP is written before this function returns.
+  *
+  * @return   handle of the commit
+  *
+  *****************************************************************************/
+  uint32_t reconfigure_fine_grain_async();
+  /****************************************************************************/
+  /**
+  *
+  * Sends to the ICAP RE the frames of the commit in flight that it can accept
+  * without waiting and checks if a commit has finished.
+  *
+  * @param commit: handle returned by reconfigure_fine_grain_async()
+  * @return   1 if the commit has finished or 0 if it is still in progress
+  *
+  *****************************************************************************/
+  int fine_grain_commit_done(uint32_t commit);
+  /****************************************************************************/
+  /**
+  *
+  * Waits until a commit started with reconfigure_fine_grain_async() finishes.
+  *
+  * @param commit: handle returned by reconfigure_fine_grain_async()
+  * @return   none
+  *
+  *****************************************************************************/
+  void wait_fine_grain_commit(uint32_t commit);
+  /****************************************************************************/
+  /**
+  *
+  * Sets a function that is called each time a fine-grain commit finishes. 
+  * When FINE_GRAIN_INTERRUPT is enabled it is called from the interrupt 
+  * handler; otherwise from the function that detects the end of the commit.
+  *
+  * @param callback: function to call (NULL to disable the callback)
+  * @param callback_ref: pointer passed to the callback
+  * @return   none
+  *
+  *****************************************************************************/
+  void set_fine_grain_commit_callback(fine_grain_commit_callback_t callback, void *callback_ref);
+  #if FINE_GRAIN_INTERRUPT
+    /****************************************************************************/
+    /**
+    *
+    * Connects the interrupt of the ICAP RE to an initialized GIC. The frames 
+    * of a commit are then sent from fine_grain_interrupt_handler() instead of 
+    * polling the RE. The application must enable the exceptions.
+    *
+    * @param gic: GIC instance initialized by the application
+    * @return   XST_SUCCESS or XST_FAILURE
+    *
+    *****************************************************************************/
+    int init_fine_grain_interrupt(XScuGic *gic);
+    /****************************************************************************/
+    /**
+    *
+    * Interrupt handler of the ICAP RE. It writes the next frames of the commit
+    * in flight and calls the commit callback when the RE finishes.
+    *
+    * @param callback_ref: not used
+    * @return   none
+    *
+    *****************************************************************************/
+    void fine_grain_interrupt_handler(void *callback_ref);
+  #endif
+  #if FINE_GRAIN_PCAP_ROUTING
+    /****************************************************************************/
+    /**
+    *
+    * Copies the statistics of the route (ICAP RE or PCAP) selected for each 
+    * fine-grain commit.
+    *
+    * @param statistics: pointer where the statistics are copied
+    * @return   none
+    *
+    *****************************************************************************/
+    void get_fine_grain_route_statistics(fine_grain_route_statistics_t *statistics);
+  #endif
+  #if FINE_GRAIN_SNAPSHOTS
+    /****************************************************************************/
+    /**
+    *
+    * Saves the current fine-grain frames and the value of every fine-grain 
+    * component of the virtual architecture under a name. If a snapshot with the
+    * same name exists it is overwritten. Pending changes that have not been 
+    * sent with reconfigure_fine_grain() are also captured.
+    *
+    * @param virtual_architecture:  
+    * @param name: name of the snapshot (at most MAX_CHARS_PER_SNAPSHOT - 1 
+    *        characters)
+    * @return   XST_SUCCESS or XST_FAILURE if there are no free snapshots
+    *
+    *****************************************************************************/
+    int save_fine_grain_snapshot(virtual_architecture_t *virtual_architecture, const char *name);
+    /****************************************************************************/
+    /**
+    *
+    * Restores a snapshot saved with save_fine_grain_snapshot() and reconfigures 
+    * the FPGA. Only the frames that differ from the current ones are written.
+    * The elements of the virtual architecture must be placed in the same 
+    * locations as when the snapshot was saved.
+    *
+    * @param virtual_architecture:  
+    * @param name: name of the snapshot
+    * @return   XST_SUCCESS or XST_FAILURE if the snapshot does not exist or 
+    *           the fine-grain frame addresses have changed
+    *
+    *****************************************************************************/
+    int apply_fine_grain_snapshot(virtual_architecture_t *virtual_architecture, const char *name);
+  #endif
 #endif
 
 #endif
@@ -5,6 +5,45 @@
   #define MAX_HEIGHT_VIRTUAL_ARCHITECTURE   1
   #define NUM_ELEMENTS                      1
   #define INITIAL_ADDR_RAM                  0x11100000 //It is necessary to free the RAM contents from this address to store the PBS 
+  #define INITIAL_ADDR_RAM_SIZE             0x00F00000 // Bytes reserved from INITIAL_ADDR_RAM for the readback (0 to disable the check)
+  
+  #define PBS_CACHE                          0 // Keep the PBS loaded from the SD card in RAM to reuse them
+  #if PBS_CACHE
+    #define PBS_CACHE_ADDR_RAM               0x12000000 // Must not overlap the memory used from INITIAL_ADDR_RAM
+    #define PBS_CACHE_SLOTS                  4
+    #define PBS_CACHE_SLOT_SIZE              0x100000 // Maximum size of a PBS (bytes)
+    #define PBS_PREFETCH                     1 // Learn the element sequence of each partition to prefetch the next PBS
+    #define PBS_CACHE_OCM                    0 // Copy the most used small PBS to the OCM and merge small regions there
+    #if PBS_CACHE_OCM
+      #define PBS_CACHE_OCM_ADDR             0x00010000 // OCM mapped at 0x0 (it must not be used by the linker script)
+      #define PBS_CACHE_OCM_SLOTS            2
+      #define PBS_CACHE_OCM_SLOT_SIZE        0x8000 // Maximum size of a PBS stored in OCM (bytes)
+      #define PBS_CACHE_OCM_SCRATCH_SIZE     0x10000 // Merge scratch placed after the OCM slots (bytes)
+    #endif
+  #endif
+  
+  #define PBS_STORE                          0 // Load the PBS from a raw SD card partition instead of FAT files
+  #if PBS_STORE
+    #define PBS_STORE_FIRST_SECTOR           0x100000 // First sector of the store image in the SD card
+    #define PBS_STORE_ADDR_RAM               0x12800000 // PBS load address when PBS_CACHE is disabled
+    #define PBS_STORE_MAX_SIZE               0x100000 // Maximum size of a PBS (bytes) when PBS_CACHE is disabled
+    #define PBS_STORE_VERIFY                 1 // Check the checksum of each PBS loaded
+  #endif
+  
+  #define RECONFIGURATION_SERVER             0 // Run the reconfiguration engine on CPU1 and send the requests from CPU0
+  #if RECONFIGURATION_SERVER
+    #define RECONFIGURATION_SERVER_SHARED_ADDR 0xFFFF0000 // OCM address of the rings shared by both CPUs
+    #define RECONFIGURATION_SERVER_RING_SIZE 16 // Must be a power of two
+  #endif
+
+  #define PARTITION_ALLOCATOR                0 // Find free positions for the elements in the reconfigurable area (allocate_partition)
+  #if PARTITION_ALLOCATOR
+    // Reconfigurable area managed by the allocator (same coordinates as pblock)
+    #define PARTITION_ALLOCATOR_X0           40
+    #define PARTITION_ALLOCATOR_Y0           0
+    #define PARTITION_ALLOCATOR_XF           59
+    #define PARTITION_ALLOCATOR_YF           49
+  #endif
   
   #define FINE_GRAIN                         1
   #if FINE_GRAIN
@@ -14,8 +53,19 @@
     #define MAX_BITS_PER_CONSTANT            0
     #define MAX_COLUMNS_CONSTANTS            0
     #define MAX_COLUMNS_MUX                  0
-    #define MAX_COLUMNS_FU                   1
+    #define MAX_COLUMNS_FU                   2
     #define MAX_COLUMN_OFFSETS               2
+    // Clock region rows that the fine-grain components of an element can span. 
+    // Each extra row grows every fine-grain layout by about 48 bytes per 
+    // constant, 208 + 104 * MAX_MUX_INPUTS bytes per mux and 240 bytes per FU, 
+    // and MAX_COLUMNS_* must hold one more frame per component and row
+    #define MAX_CLOCK_ROWS_PER_ELEMENT       2
+    #define MAX_MUX_INPUTS                   4
+    #define MAX_FINE_GRAIN_PARTITIONS        1 // Partitions that can hold elements with fine-grain components
+    #define MAX_FU_USER_FUNCTIONS            14 // FU functions that can be registered at run time
+    #define FINE_GRAIN_SNAPSHOTS             0 // Number of fine-grain frame images that can be saved and reapplied
+    #define FINE_GRAIN_INTERRUPT             0 // Send the fine-grain frames from the RE interrupt instead of polling it
+    #define FINE_GRAIN_PCAP_ROUTING          0 // Write large fine-grain commits through the PCAP when it is estimated to be faster than the RE
   #endif
 
 #endif
\ No newline at end of file
@@ -0,0 +1,426 @@
+/*
+ * PBS_cache.c
+ *
+ * RAM cache of partial bitstreams. Each PBS is stored in a fixed size slot
+ * starting at PBS_CACHE_ADDR_RAM. When there are no free slots the least
+ * recently used PBS is evicted.
+ *
+ * When PBS_CACHE_OCM is enabled the small PBS that are used most often are
+ * also copied to slots in the on-chip memory, so the storage is organized in
+ * three tiers: OCM (hot), DDR (warm) and SD card (cold). The access frequency
+ * of each element is aged periodically so the OCM follows the recent use.
+ */
+
+
+/***************************** Include Files ********************************/
+#include "PBS_cache.h"
+
+#if PBS_CACHE
+
+#include <string.h>
+#include "reconfig_pcap.h"
+#include "xstatus.h"
+#if PBS_STORE
+#include "PBS_store.h"
+#endif
+
+
+/************************** Constant Definitions ****************************/
+#define PBS_CACHE_EMPTY_SLOT -1
+#define PBS_CACHE_AGING_PERIOD 256 // Accesses between two halvings of the access frequencies
+
+
+/**************************** Type Definitions *******************************/
+
+typedef struct {
+	int element;       // Element stored in the slot or PBS_CACHE_EMPTY_SLOT
+	UINTPTR last_addr; // Last RAM position of the PBS
+	u32 last_use;      // Value of the access counter the last time it was used
+	u8 prefetched;     // The PBS was prefetched and it has not been used yet
+	u8 pinned;         // The PBS can not be evicted
+} PBS_cache_slot_t;
+
+
+/************************** Function Prototypes *****************************/
+static int find_slot(int element);
+static int replace_slot(const u8 *protected_elements);
+static u32 *slot_addr(int slot);
+static UINTPTR load_PBS(int element, const char *file_name, u32 *addr);
+static int load_slot(int element, const char *file_name, const u8 *protected_elements);
+#if PBS_CACHE_OCM
+static int find_OCM_slot(int element);
+static int promote_to_OCM(int element, int slot, u8 force);
+static u32 *OCM_slot_addr(int slot);
+static void update_access_frequency(int element);
+#endif
+
+
+/************************** Variable Definitions ****************************/
+static PBS_cache_slot_t slots[PBS_CACHE_SLOTS];
+static u32 access_counter;
+static PBS_cache_statistics_t cache_statistics;
+#if PBS_CACHE_OCM
+static PBS_cache_slot_t OCM_slots[PBS_CACHE_OCM_SLOTS];
+static u16 access_frequency[NUM_ELEMENTS];
+#endif
+
+
+/************************** Function Definitions ****************************/
+
+void PBS_cache_init()
+{
+	int i;
+
+	for (i = 0; i < PBS_CACHE_SLOTS; i++) {
+		slots[i].element = PBS_CACHE_EMPTY_SLOT;
+		slots[i].last_addr = 0;
+		slots[i].last_use = 0;
+		slots[i].prefetched = 0;
+		slots[i].pinned = 0;
+	}
+#if PBS_CACHE_OCM
+	for (i = 0; i < PBS_CACHE_OCM_SLOTS; i++) {
+		OCM_slots[i].element = PBS_CACHE_EMPTY_SLOT;
+		OCM_slots[i].last_addr = 0;
+		OCM_slots[i].last_use = 0;
+		OCM_slots[i].prefetched = 0;
+		OCM_slots[i].pinned = 0;
+	}
+	for (i = 0; i < NUM_ELEMENTS; i++) {
+		access_frequency[i] = 0;
+	}
+	cache_statistics.OCM_hits = 0;
+	cache_statistics.promotions = 0;
+#endif
+	access_counter = 0;
+	cache_statistics.hits = 0;
+	cache_statistics.misses = 0;
+	cache_statistics.prefetches = 0;
+	cache_statistics.prefetch_hits = 0;
+	cache_statistics.wasted_prefetch_bytes = 0;
+}
+
+int PBS_cache_get(int element, const char *file_name, u32 **PBS_addr, UINTPTR *PBS_last_addr)
+{
+	int slot;
+#if PBS_CACHE_OCM
+	int OCM_slot;
+
+	update_access_frequency(element);
+	OCM_slot = find_OCM_slot(element);
+	if (OCM_slot >= 0) {
+		cache_statistics.hits++;
+		cache_statistics.OCM_hits++;
+		OCM_slots[OCM_slot].last_use = ++access_counter;
+		*PBS_addr = OCM_slot_addr(OCM_slot);
+		*PBS_last_addr = OCM_slots[OCM_slot].last_addr;
+		return XST_SUCCESS;
+	}
+#endif
+
+	slot = find_slot(element);
+	if (slot >= 0) {
+		cache_statistics.hits++;
+		if (slots[slot].prefetched) {
+			cache_statistics.prefetch_hits++;
+			slots[slot].prefetched = 0;
+		}
+	} else {
+		cache_statistics.misses++;
+		slot = load_slot(element, file_name, NULL);
+		if (slot < 0) {
+			return XST_FAILURE;
+		}
+	}
+	slots[slot].last_use = ++access_counter;
+
+#if PBS_CACHE_OCM
+	OCM_slot = promote_to_OCM(element, slot, 0);
+	if (OCM_slot >= 0) {
+		*PBS_addr = OCM_slot_addr(OCM_slot);
+		*PBS_last_addr = OCM_slots[OCM_slot].last_addr;
+		return XST_SUCCESS;
+	}
+#endif
+
+	*PBS_addr = slot_addr(slot);
+	*PBS_last_addr = slots[slot].last_addr;
+
+	return XST_SUCCESS;
+}
+
+int PBS_cache_prefetch(int element, const char *file_name, const u8 *protected_elements)
+{
+	int slot;
+
+	if (PBS_cache_contains(element)) {
+		return 0;
+	}
+
+	slot = load_slot(element, file_name, protected_elements);
+	if (slot == -2) {
+		return 0;
+	} else if (slot < 0) {
+		return -1;
+	}
+	slots[slot].prefetched = 1;
+	// A prefetched PBS is inserted as the most recently used one so that it is
+	// not evicted by the next miss
+	slots[slot].last_use = ++access_counter;
+	cache_statistics.prefetches++;
+
+	return 1;
+}
+
+int PBS_cache_contains(int element)
+{
+#if PBS_CACHE_OCM
+	if (find_OCM_slot(element) >= 0) {
+		return 1;
+	}
+#endif
+	return find_slot(element) >= 0;
+}
+
+int PBS_cache_pin(int element, const char *file_name, PBS_cache_tier_t tier)
+{
+	int slot;
+
+	slot = find_slot(element);
+	if (slot < 0) {
+		slot = load_slot(element, file_name, NULL);
+		if (slot < 0) {
+			return XST_FAILURE;
+		}
+	}
+	slots[slot].last_use = ++access_counter;
+
+	if (tier == PBS_CACHE_TIER_DDR) {
+		slots[slot].pinned = 1;
+		return XST_SUCCESS;
+	}
+
+#if PBS_CACHE_OCM
+	if (tier == PBS_CACHE_TIER_OCM) {
+		if (find_OCM_slot(element) < 0) {
+			slot = promote_to_OCM(element, slot, 1);
+		} else {
+			slot = find_OCM_slot(element);
+		}
+		if (slot < 0) {
+			return XST_FAILURE;
+		}
+		OCM_slots[slot].pinned = 1;
+		return XST_SUCCESS;
+	}
+#endif
+
+	return XST_FAILURE;
+}
+
+void PBS_cache_unpin(int element)
+{
+	int slot;
+
+	slot = find_slot(element);
+	if (slot >= 0) {
+		slots[slot].pinned = 0;
+	}
+#if PBS_CACHE_OCM
+	slot = find_OCM_slot(element);
+	if (slot >= 0) {
+		OCM_slots[slot].pinned = 0;
+	}
+#endif
+}
+
+#if PBS_CACHE_OCM
+u32 *PBS_cache_OCM_scratch(u32 bytes)
+{
+	if (bytes > PBS_CACHE_OCM_SCRATCH_SIZE) {
+		return NULL;
+	}
+	return OCM_slot_addr(PBS_CACHE_OCM_SLOTS);
+}
+#endif
+
+void PBS_cache_get_statistics(PBS_cache_statistics_t *statistics)
+{
+	*statistics = cache_statistics;
+}
+
+static int find_slot(int element)
+{
+	int i;
+
+	for (i = 0; i < PBS_CACHE_SLOTS; i++) {
+		if (slots[i].element == element) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+/*
+ * Selects a free slot or the least recently used one that is not pinned. The
+ * slot is invalidated before returning it so that a failed load does not leave
+ * stale data. Prefetches pass the elements that are predicted (protected_elements,
+ * NULL for demand loads) and they never evict them or a prefetched PBS that
+ * has not been used yet, so several predictions can not evict each other.
+ */
+static int replace_slot(const u8 *protected_elements)
+{
+	int i, slot;
+
+	slot = -1;
+	for (i = 0; i < PBS_CACHE_SLOTS; i++) {
+		if (slots[i].element == PBS_CACHE_EMPTY_SLOT) {
+			slot = i;
+			break;
+		}
+		if (slots[i].pinned) {
+			continue;
+		}
+		if (protected_elements != NULL && (slots[i].prefetched || protected_elements[slots[i].element])) {
+			continue;
+		}
+		if (slot < 0 || slots[i].last_use < slots[slot].last_use) {
+			slot = i;
+		}
+	}
+	if (slot < 0) {
+		return -1;
+	}
+
+	if (slots[slot].element != PBS_CACHE_EMPTY_SLOT && slots[slot].prefetched) {
+		cache_statistics.wasted_prefetch_bytes += slots[slot].last_addr - (UINTPTR) slot_addr(slot);
+	}
+	slots[slot].element = PBS_CACHE_EMPTY_SLOT;
+	slots[slot].prefetched = 0;
+	slots[slot].pinned = 0;
+
+	return slot;
+}
+
+static u32 *slot_addr(int slot)
+{
+	return (u32 *) (PBS_CACHE_ADDR_RAM + slot * PBS_CACHE_SLOT_SIZE);
+}
+
+static UINTPTR load_PBS(int element, const char *file_name, u32 *addr)
+{
+#if PBS_STORE
+	return PBS_store_load(element, addr, PBS_CACHE_SLOT_SIZE);
+#else
+	return load_bitstream_from_SD_to_RAM_bounded(file_name, addr, PBS_CACHE_SLOT_SIZE);
+#endif
+}
+
+/*
+ * Loads a PBS from the SD card in a DDR slot. Returns the slot, -2 if there is
+ * no slot that can be replaced or -1 if the PBS could not be loaded.
+ */
+static int load_slot(int element, const char *file_name, const u8 *protected_elements)
+{
+	int slot;
+
+	slot = replace_slot(protected_elements);
+	if (slot < 0) {
+		return -2;
+	}
+	slots[slot].last_addr = load_PBS(element, file_name, slot_addr(slot));
+	if (slots[slot].last_addr == 0) {
+		return -1;
+	}
+	slots[slot].element = element;
+
+	return slot;
+}
+
+#if PBS_CACHE_OCM
+static int find_OCM_slot(int element)
+{
+	int i;
+
+	for (i = 0; i < PBS_CACHE_OCM_SLOTS; i++) {
+		if (OCM_slots[i].element == element) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+/*
+ * Copies a PBS stored in a DDR slot to the OCM if it fits in an OCM slot and
+ * it is used more often than one of the PBS already stored in the OCM (or if
+ * force is set). Pinned PBS are never replaced. Returns the OCM slot or -1 if
+ * the PBS has not been promoted.
+ */
+static int promote_to_OCM(int element, int slot, u8 force)
+{
+	int i, OCM_slot;
+	UINTPTR bytes;
+
+	bytes = slots[slot].last_addr - (UINTPTR) slot_addr(slot);
+	if (bytes > PBS_CACHE_OCM_SLOT_SIZE) {
+		return -1;
+	}
+
+	// Free slot or the least frequently used one
+	OCM_slot = -1;
+	for (i = 0; i < PBS_CACHE_OCM_SLOTS; i++) {
+		if (OCM_slots[i].element == PBS_CACHE_EMPTY_SLOT) {
+			OCM_slot = i;
+			break;
+		}
+		if (!OCM_slots[i].pinned && (OCM_slot < 0 ||
+				access_frequency[OCM_slots[i].element] < access_frequency[OCM_slots[OCM_slot].element] ||
+				(access_frequency[OCM_slots[i].element] == access_frequency[OCM_slots[OCM_slot].element] && OCM_slots[i].last_use < OCM_slots[OCM_slot].last_use))) {
+			OCM_slot = i;
+		}
+	}
+	if (OCM_slot < 0) {
+		return -1;
+	}
+	if (!force && OCM_slots[OCM_slot].element != PBS_CACHE_EMPTY_SLOT &&
+			access_frequency[OCM_slots[OCM_slot].element] >= access_frequency[element]) {
+		return -1;
+	}
+
+	memcpy(OCM_slot_addr(OCM_slot), slot_addr(slot), bytes);
+	OCM_slots[OCM_slot].element = element;
+	OCM_slots[OCM_slot].last_addr = (UINTPTR) OCM_slot_addr(OCM_slot) + bytes;
+	OCM_slots[OCM_slot].last_use = slots[slot].last_use;
+	OCM_slots[OCM_slot].pinned = 0;
+	cache_statistics.promotions++;
+
+	return OCM_slot;
+}
+
+/*
+ * The merge scratch is placed after the last OCM slot
+ */
+static u32 *OCM_slot_addr(int slot)
+{
+	return (u32 *) (PBS_CACHE_OCM_ADDR + slot * PBS_CACHE_OCM_SLOT_SIZE);
+}
+
+static void update_access_frequency(int element)
+{
+	int i;
+
+	if (element < 0 || element >= NUM_ELEMENTS) {
+		return;
+	}
+	if (access_frequency[element] < 0xFFFF) {
+		access_frequency[element]++;
+	}
+	if ((access_counter + 1) % PBS_CACHE_AGING_PERIOD == 0) {
+		for (i = 0; i < NUM_ELEMENTS; i++) {
+			access_frequency[i] >>= 1;
+		}
+	}
+}
+#endif
+
+#endif
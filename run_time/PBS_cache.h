@@ -0,0 +1,156 @@
+/*
+ * PBS_cache.h
+ *
+ * RAM cache of partial bitstreams. PBS files are kept in RAM slots after they
+ * are loaded from the SD card so that later reconfigurations (or speculative
+ * prefetches) do not need to access the SD card again. Optionally, the most
+ * used small PBS are promoted to the on-chip memory (PBS_CACHE_OCM).
+ */
+
+#ifndef PBS_CACHE_H_
+#define PBS_CACHE_H_
+
+/***************************** Include Files ********************************/
+#include "xil_types.h"
+#include "IMPRESS_reconfiguration_parameters.h"
+
+#if PBS_CACHE
+
+/**************************** Type Definitions *******************************/
+
+typedef enum {
+	PBS_CACHE_TIER_DDR,
+	PBS_CACHE_TIER_OCM
+} PBS_cache_tier_t;
+
+typedef struct {
+	u32 hits;                  // PBS requests served from RAM
+	u32 misses;                // PBS requests that had to be loaded from SD
+	u32 prefetches;            // PBS loaded speculatively from SD
+	u32 prefetch_hits;         // Prefetched PBS that were used afterwards
+	u32 wasted_prefetch_bytes; // Bytes of prefetched PBS evicted without being used
+#if PBS_CACHE_OCM
+	u32 OCM_hits;              // PBS requests served from OCM
+	u32 promotions;            // PBS copied from DDR to OCM
+#endif
+} PBS_cache_statistics_t;
+
+/************************** Function Prototypes *****************************/
+
+/****************************************************************************/
+/**
+*
+* Invalidates all the cache slots and resets the statistics
+*
+* @return	none
+*
+*****************************************************************************/
+void PBS_cache_init();
+
+/****************************************************************************/
+/**
+*
+* Obtains the RAM position of a PBS. If the PBS is not in the cache it is
+* loaded from the SD card into the least recently used slot.
+*
+* @param element is the number that identifies the PBS in the cache
+* @param file_name is the name of the PBS file stored in the SD card
+* @param PBS_addr returns the first RAM position of the PBS
+* @param PBS_last_addr returns the last RAM position of the PBS
+*
+* @return	XST_SUCCESS else XST_FAILURE.
+*
+*****************************************************************************/
+int PBS_cache_get(int element, const char *file_name, u32 **PBS_addr, UINTPTR *PBS_last_addr);
+
+/****************************************************************************/
+/**
+*
+* Loads a PBS in the cache before it is needed. The PBS is marked as a
+* prefetch so that hits and wasted loads can be accounted. A prefetch never
+* evicts a pinned PBS, a prefetched PBS that has not been used yet or a
+* protected one.
+*
+* @param element is the number that identifies the PBS in the cache
+* @param file_name is the name of the PBS file stored in the SD card
+* @param protected_elements is an array of NUM_ELEMENTS flags with the
+*        elements that must be kept in the cache (e.g. other predictions)
+*
+* @return	1 if the PBS has been loaded, 0 if it was already in the cache or
+*           there is no slot that can be replaced and -1 if it could not be
+*           loaded
+*
+*****************************************************************************/
+int PBS_cache_prefetch(int element, const char *file_name, const u8 *protected_elements);
+
+/****************************************************************************/
+/**
+*
+* Checks if a PBS is stored in the cache without modifying its state
+*
+* @param element is the number that identifies the PBS in the cache
+*
+* @return	1 if the PBS is in the cache else 0
+*
+*****************************************************************************/
+int PBS_cache_contains(int element);
+
+/****************************************************************************/
+/**
+*
+* Keeps a PBS in a tier until it is unpinned. The PBS is loaded if it is not
+* in the cache. Pinning to the OCM replaces the least used PBS of the OCM even
+* if it is used more often than the pinned one.
+*
+* @param element is the number that identifies the PBS in the cache
+* @param file_name is the name of the PBS file stored in the SD card
+* @param tier is the tier where the PBS is kept (PBS_CACHE_TIER_OCM requires
+*        PBS_CACHE_OCM)
+*
+* @return	XST_SUCCESS else XST_FAILURE (the PBS does not fit in the tier or
+*           all its slots are pinned).
+*
+*****************************************************************************/
+int PBS_cache_pin(int element, const char *file_name, PBS_cache_tier_t tier);
+
+/****************************************************************************/
+/**
+*
+* Allows a pinned PBS to be evicted again
+*
+* @param element is the number that identifies the PBS in the cache
+*
+* @return	none
+*
+*****************************************************************************/
+void PBS_cache_unpin(int element);
+
+#if PBS_CACHE_OCM
+/****************************************************************************/
+/**
+*
+* Obtains the OCM region reserved to read back and merge small regions
+*
+* @param bytes is the size needed
+*
+* @return	first position of the region or NULL if it is too small
+*
+*****************************************************************************/
+u32 *PBS_cache_OCM_scratch(u32 bytes);
+#endif
+
+/****************************************************************************/
+/**
+*
+* Copies the cache statistics
+*
+* @param statistics is a pointer where the statistics are copied
+*
+* @return	none
+*
+*****************************************************************************/
+void PBS_cache_get_statistics(PBS_cache_statistics_t *statistics);
+
+#endif
+
+#endif /* PBS_CACHE_H_ */
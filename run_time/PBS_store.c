@@ -0,0 +1,208 @@
+/*
+ * PBS_store.c
+ *
+ * Raw partition partial bitstream store. In bare-metal the sectors are read
+ * with the FatFs low level disk functions, which perform multi-block DMA
+ * transfers. In Linux (PCAP_LINUX) the store is a regular file, which is also
+ * used as a stand-in of the SD card partition for testing.
+ */
+
+
+/***************************** Include Files ********************************/
+#include "PBS_store.h"
+
+#if PBS_STORE
+
+#include "series7.h"
+#include "device.h"
+
+#ifdef PCAP_LINUX
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#include "diskio.h"
+#include "xstatus.h"
+#include "xil_cache.h"
+#endif
+
+
+/************************** Constant Definitions ****************************/
+#define PBS_STORE_DRIVE          0 // Physical drive of the SD card
+#define PBS_STORE_HEADER_WORDS   3
+#define PBS_STORE_INDEX_SECTORS  (((PBS_STORE_HEADER_WORDS * 4 + NUM_ELEMENTS * sizeof(PBS_store_entry_t)) + PBS_STORE_SECTOR_BYTES - 1) / PBS_STORE_SECTOR_BYTES)
+
+
+/************************** Function Prototypes *****************************/
+static int read_sectors(u32 *buffer, u32 sector, u32 count);
+
+
+/************************** Variable Definitions ****************************/
+static PBS_store_entry_t PBS_store_index[NUM_ELEMENTS];
+static u8 store_ready = 0;
+static u32 index_buffer[PBS_STORE_INDEX_SECTORS * PBS_STORE_SECTOR_BYTES / 4] __attribute__ ((aligned (32)));
+#ifdef PCAP_LINUX
+static int store_fd = -1;
+#endif
+
+
+/************************** Function Definitions ****************************/
+
+int PBS_store_init()
+{
+	PBS_store_entry_t *entries;
+	int i;
+#ifdef PCAP_LINUX
+	const char *file_name;
+#endif
+
+	store_ready = 0;
+#ifdef PCAP_LINUX
+	file_name = getenv(PBS_STORE_FILE_ENV);
+	if (file_name == NULL) {
+		file_name = PBS_STORE_FILE;
+	}
+	store_fd = open(file_name, O_RDONLY);
+	if (store_fd < 0) {
+		return XST_FAILURE;
+	}
+#else
+	if (disk_initialize(PBS_STORE_DRIVE) & STA_NOINIT) {
+		return XST_FAILURE;
+	}
+#endif
+
+	if (read_sectors(index_buffer, 0, PBS_STORE_INDEX_SECTORS) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	if (index_buffer[0] != PBS_STORE_MAGIC || index_buffer[1] != PBS_STORE_VERSION || index_buffer[2] < NUM_ELEMENTS) {
+		xil_printf("ERROR: PBS store not valid\n");
+		return XST_FAILURE;
+	}
+
+	entries = (PBS_store_entry_t *) &index_buffer[PBS_STORE_HEADER_WORDS];
+	for (i = 0; i < NUM_ELEMENTS; i++) {
+		if (entries[i].element != i || entries[i].num_rows > PBS_STORE_MAX_ROWS) {
+			return XST_FAILURE;
+		}
+		PBS_store_index[i] = entries[i];
+	}
+	store_ready = 1;
+
+	return XST_SUCCESS;
+}
+
+UINTPTR PBS_store_load(int element, u32 *addr_start, u32 max_bytes)
+{
+	PBS_store_entry_t *entry;
+	u32 sectors;
+#if PBS_STORE_VERIFY
+	u32 i, checksum;
+#endif
+
+	if (!store_ready || element < 0 || element >= NUM_ELEMENTS) {
+		return 0;
+	}
+	entry = &PBS_store_index[element];
+	sectors = (entry->length + PBS_STORE_SECTOR_BYTES - 1) / PBS_STORE_SECTOR_BYTES;
+	if (sectors * PBS_STORE_SECTOR_BYTES > max_bytes) {
+		xil_printf("ERROR: PBS of element %d does not fit in %d bytes\n", element, max_bytes);
+		return 0;
+	}
+
+	// The words are stored in the order they are sent to the PCAP, so they are
+	// transferred directly to their final position
+	if (read_sectors(addr_start, entry->sector, sectors) != XST_SUCCESS) {
+		return 0;
+	}
+
+#if PBS_STORE_VERIFY
+	checksum = 0;
+	for (i = 0; i < entry->length / 4; i++) {
+		checksum += addr_start[i];
+	}
+	if (checksum != entry->checksum) {
+		xil_printf("ERROR: PBS of element %d is corrupted\n", element);
+		return 0;
+	}
+#endif
+
+	return (UINTPTR) addr_start + entry->length;
+}
+
+const PBS_store_entry_t *PBS_store_get_entry(int element)
+{
+	if (!store_ready || element < 0 || element >= NUM_ELEMENTS) {
+		return NULL;
+	}
+	return &PBS_store_index[element];
+}
+
+int PBS_store_check_geometry(int element, const pblock *pblock_region)
+{
+	const PBS_store_entry_t *entry;
+	int initial_row, final_row, first_rows_not_used, last_rows_not_used;
+	int y;
+	u32 frames;
+
+	entry = PBS_store_get_entry(element);
+	if (entry == NULL) {
+		return XST_FAILURE;
+	}
+	if (entry->num_rows == 0) {
+		// The PBS was stored without geometry information
+		return XST_SUCCESS;
+	}
+
+	if (pblock_region->Xf - pblock_region->X0 != (int) (entry->Xf - entry->X0) ||
+			pblock_region->Yf - pblock_region->Y0 != (int) (entry->Yf - entry->Y0) ||
+			pblock_region->Y0 % CLOCK_REGION_ROWS != (int) (entry->Y0 % CLOCK_REGION_ROWS)) {
+		xil_printf("ERROR: PBS of element %d does not fit in X%dY%d:X%dY%d\n", element,
+				pblock_region->X0, pblock_region->Y0, pblock_region->Xf, pblock_region->Yf);
+		return XST_FAILURE;
+	}
+
+	initial_row = pblock_region->Y0 / CLOCK_REGION_ROWS;
+	final_row = pblock_region->Yf / CLOCK_REGION_ROWS;
+	if (final_row - initial_row + 1 != (int) entry->num_rows || initial_row < 0 || final_row >= fpga_device->rows || pblock_region->X0 < 0 || pblock_region->Xf >= fpga_device->columns) {
+		return XST_FAILURE;
+	}
+
+	for (y = initial_row; y <= final_row; y++) {
+		first_rows_not_used = (y == initial_row) ? pblock_region->Y0 % CLOCK_REGION_ROWS : 0;
+		last_rows_not_used = (y == final_row) ? CLOCK_REGION_ROWS - 1 - pblock_region->Yf % CLOCK_REGION_ROWS : 0;
+		frames = FRAMES_IN_COLUMNS(y, pblock_region->X0, pblock_region->Xf);
+		if (frames * ROWS_TO_WORDS(CLOCK_REGION_ROWS - first_rows_not_used - last_rows_not_used) * 4 != entry->row_bytes[y - initial_row]) {
+			xil_printf("ERROR: PBS of element %d is not compatible with the columns of X%dY%d:X%dY%d\n", element,
+					pblock_region->X0, pblock_region->Y0, pblock_region->Xf, pblock_region->Yf);
+			return XST_FAILURE;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+static int read_sectors(u32 *buffer, u32 sector, u32 count)
+{
+#ifdef PCAP_LINUX
+	ssize_t bytes;
+
+	bytes = pread(store_fd, buffer, count * PBS_STORE_SECTOR_BYTES, (off_t) sector * PBS_STORE_SECTOR_BYTES);
+	// The last sector of the image can be incomplete
+	if (bytes <= 0 || bytes <= (ssize_t) ((count - 1) * PBS_STORE_SECTOR_BYTES)) {
+		return XST_FAILURE;
+	}
+#else
+	// Dirty lines of the buffer must not be evicted over the DMA transfer
+	Xil_DCacheFlushRange((UINTPTR) buffer, count * PBS_STORE_SECTOR_BYTES);
+	if (disk_read(PBS_STORE_DRIVE, (BYTE *) buffer, PBS_STORE_FIRST_SECTOR + sector, count) != RES_OK) {
+		return XST_FAILURE;
+	}
+	// Lines fetched speculatively during the transfer are discarded
+	Xil_DCacheInvalidateRange((UINTPTR) buffer, count * PBS_STORE_SECTOR_BYTES);
+#endif
+
+	return XST_SUCCESS;
+}
+
+#endif
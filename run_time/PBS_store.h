@@ -0,0 +1,118 @@
+/*
+ * PBS_store.h
+ *
+ * Partial bitstream store located in a raw partition of the SD card. All the
+ * PBS are packed in a single image, each of them starting at a sector
+ * boundary, so they can be read with multi-block transfers without going
+ * through the FAT file system. The image is generated with
+ * design_time/reconfiguration_tool/auxiliary_tools/build_PBS_store.py
+ *
+ * Image format (little endian 32-bit words):
+ *   header:  magic, version, number of entries
+ *   TOC:     one entry per element ordered by element number (see
+ *            PBS_store_entry_t)
+ *   data:    PBS words in the order they are written to the PCAP
+ *
+ * The TOC is read once when the virtual architecture is initialized, so the
+ * PBS are located and validated by element number without any file name.
+ */
+
+#ifndef PBS_STORE_H_
+#define PBS_STORE_H_
+
+/***************************** Include Files ********************************/
+#include "IMPRESS_reconfiguration_parameters.h"
+#include "reconfig_pcap.h"
+#include "device.h"
+
+#if PBS_STORE
+
+/**************************** Constant Definitions *******************************/
+#define PBS_STORE_MAGIC          0x50425353 // "PBSS"
+#define PBS_STORE_VERSION        3
+#define PBS_STORE_SECTOR_BYTES   512
+#define PBS_STORE_MAX_ROWS       MAX_ROWS // Maximum clock region rows of a PBS described in the TOC (MAX_ROWS in build_PBS_store.py)
+
+// File used as the store in Linux (it can be changed with the environment
+// variable PBS_STORE_FILE_ENV)
+#define PBS_STORE_FILE           "PBS_store.img"
+#define PBS_STORE_FILE_ENV       "IMPRESS_PBS_STORE"
+
+
+/**************************** Type Definitions *******************************/
+
+typedef struct {
+	u32 element;
+	u32 sector;     // First sector of the PBS relative to the beginning of the store
+	u32 length;     // Bytes
+	u32 checksum;   // Sum of all the words of the PBS
+	// Geometry of the region where the PBS was extracted (same coordinates as pblock)
+	u32 X0;
+	u32 Y0;
+	u32 Xf;
+	u32 Yf;
+	u32 num_rows;   // Clock region rows of the PBS (0 if the geometry is unknown)
+	u32 row_bytes[PBS_STORE_MAX_ROWS]; // Bytes of the PBS in each clock region row
+} PBS_store_entry_t;
+
+
+/************************** Function Prototypes *****************************/
+
+/****************************************************************************/
+/**
+*
+* Reads the index of the store. It has to be called before loading any PBS.
+*
+* @return	XST_SUCCESS else XST_FAILURE.
+*
+*****************************************************************************/
+int PBS_store_init();
+
+/****************************************************************************/
+/**
+*
+* Loads the PBS of an element from the store to the RAM
+*
+* @param element is the element number (position in elements variable)
+* @param addr_start is the initial position of the PBS in the RAM
+* @param max_bytes is the size of the RAM region that can store the PBS. As
+*        whole sectors are read, up to PBS_STORE_SECTOR_BYTES - 1 bytes after
+*        the PBS can be overwritten
+*
+* @return	final position of the PBS in the RAM or 0 if the PBS could not be
+*           loaded
+*
+*****************************************************************************/
+UINTPTR PBS_store_load(int element, u32 *addr_start, u32 max_bytes);
+
+/****************************************************************************/
+/**
+*
+* Returns the TOC entry of an element
+*
+* @param element is the element number (position in elements variable)
+*
+* @return	pointer to the entry or NULL if the store is not initialized
+*
+*****************************************************************************/
+const PBS_store_entry_t *PBS_store_get_entry(int element);
+
+/****************************************************************************/
+/**
+*
+* Checks that the PBS of an element can be written in a region. The region
+* must have the same size and the same alignment with the clock region rows
+* as the region where the PBS was extracted, and the frames of its columns
+* must match the bytes of each row of the PBS.
+*
+* @param element is the element number (position in elements variable)
+* @param pblock_region is the region where the PBS is going to be written
+*
+* @return	XST_SUCCESS else XST_FAILURE.
+*
+*****************************************************************************/
+int PBS_store_check_geometry(int element, const pblock *pblock_region);
+
+#endif
+
+#endif /* PBS_STORE_H_ */
@@ -10,15 +10,17 @@
 
 /***************************** Include Files ********************************/
 #include "reconfig_pcap.h"
-#include "ff.h"
 #include "string.h"
+#ifndef PCAP_LINUX
+#include "ff.h"
 #include "xtime_l.h"
 #include "xstatus.h"
 #include "xil_assert.h"
 #include "xil_cache.h"
+#endif
 
 // FPGA description file
-#include "xc7z020.h"
+#include "device.h"
 #include "series7.h"
 
 
@@ -40,7 +42,18 @@
 #define PCAP_CLK_DIVISOR 0x0A       // PCAP clock divisor (6bits)
 #define PCAP_CLK_SOURCE 0x0         // PCAP clock source (0b00 -> IO PLL@1000Hz; 0b10 -> ARM PLL@1333Hz; 0b11 -> DDR PLL@1067Hz)
 
+#define PCAP_CLOCK_WORDS_CACHE           // If defined, the clock words read back are stored so that regions covering whole clock region rows are reconfigured without readback
+#define PCAP_CLOCK_WORDS_CACHE_SIZE (MAX_ROWS * MAX_ROW_FRAMES) // Maximum number of clock words that can be stored
+
 //#define PCAP_TIMING // If defined, elapsed times will be computed
+
+#ifdef PCAP_LINUX
+#undef PCAP_CLK_RW // The PCAP clock is managed by the Linux driver
+#ifdef PCAP_TIMING
+#error PCAP_TIMING is only available in bare-metal
+#endif
+#endif
+
 #ifdef PCAP_TIMING
 #include "stdio.h" // Include printf(...) function
 #endif // #ifdef PCAP_TIMING
@@ -48,6 +61,24 @@
 
 /************************** Function Prototypes *****************************/
 
+#ifdef PCAP_CLOCK_WORDS_CACHE
+static void store_clock_words(u32 *addr_start, u32 row, u32 x0, u32 xf);
+static int load_clock_words(u32 **addr_start, u32 row, u32 x0, u32 xf);
+#endif
+static int write_subclock_region(XDcfg *InstancePtr, u32 *addr_start, const char *file_name, u32 *PBS_addr, UINTPTR PBS_last_addr, pblock pblock_list[], u32 num_pblocks, u32 erase_bram, u8 stacked_modules);
+static u32 add_write_header(u32 *WriteBuffer);
+static u32 add_frames_header(u32 *WriteBuffer, u32 frame_address, u32 TotalWords);
+static u32 add_write_trailer(u32 *WriteBuffer);
+
+/************************** Variable Definitions ****************************/
+#ifdef PCAP_CLOCK_WORDS_CACHE
+static u32 clock_words_cache[PCAP_CLOCK_WORDS_CACHE_SIZE];
+static u16 clock_words_index[MAX_ROWS][MAX_COLUMNS]; // First clock word of the column in clock_words_cache plus one (0 if not stored)
+static u8 clock_words_valid[MAX_ROWS][MAX_COLUMNS]; // The stored clock words match the FPGA
+static u32 clock_words_cache_used;
+#endif
+
+
 /****************************************************************************/
 /**
 *
@@ -59,10 +90,30 @@
 * @return final position of the PBS in the RAM
 *
 *****************************************************************************/
-u32 load_bitstream_from_SD_to_RAM(const char *file_name, u32 *addr_start) 
+UINTPTR load_bitstream_from_SD_to_RAM(const char *file_name, u32 *addr_start)
+{
+    return load_bitstream_from_SD_to_RAM_bounded(file_name, addr_start, 0xFFFFFFFF);
+}
+
+#ifndef PCAP_LINUX
+/****************************************************************************/
+/**
+*
+* Loads a partial bitstream file from the external SD card to the on-board RAM
+* checking that it fits in the memory region reserved for it
+*
+* @param file_name is the name of the PBS file stored in the SD card
+* @param addr_start is the initial position of the PBS in the RAM
+* @param max_bytes is the size of the RAM region that can store the PBS
+*
+* @return final position of the PBS in the RAM or 0 if the PBS could not be
+*         loaded
+*
+*****************************************************************************/
+UINTPTR load_bitstream_from_SD_to_RAM_bounded(const char *file_name, u32 *addr_start, u32 max_bytes)
 {
   // Local variables
-    u32 Index;
+    UINTPTR Index;
     UINT bytes;		  // Byte count (memory positions)
     u32 *buffer;      // Pointer to memory region in which PBS is to be stored
     FATFS fatfs;      // FAT file system
@@ -92,8 +143,16 @@ u32 load_bitstream_from_SD_to_RAM(const char *file_name, u32 *addr_start)
         return 0;
     }
 
+    // Check that the PBS fits in the reserved memory
+    if(f_size(&file) > max_bytes)
+    {
+        xil_printf("ERROR: File %s does not fit in %d bytes\n", file_name, max_bytes);
+        f_close(&file);
+        return 0;
+    }
+
     // Initialize variables
-    Index = (u32)addr_start;
+    Index = (UINTPTR) addr_start;
     buffer = addr_start;
 
     // Load partial bitstream into memory
@@ -109,7 +168,7 @@ u32 load_bitstream_from_SD_to_RAM(const char *file_name, u32 *addr_start)
 
     // Reorder wrong byte endianness
     buffer = addr_start;
-    for(i = 0; i < ((Index - (int)addr_start)/sizeof(u32)); i++)
+    for(i = 0; i < ((Index - (UINTPTR) addr_start)/sizeof(u32)); i++)
     {
         aux = ((buffer[i] & 0xFF) << 24) + ((buffer[i] & 0xFF00) << 8) + ((buffer[i] & 0xFF0000) >> 8) + ((buffer[i] & 0xFF000000) >> 24);
         buffer[i] = aux;
@@ -285,6 +344,169 @@ int PCAP_Initialize(XDcfg *InstancePtr, u16 DeviceId)
     return XST_SUCCESS;
 }
 
+/****************************************************************************/
+/**
+*
+* Transfers data through the PCAP DMA and waits until it finishes
+*
+* @param InstancePtr is a pointer to the PCAP instance.
+* @param source is the data to write in the PCAP (NULL if nothing is written)
+* @param source_words is the number of words to write
+* @param destination is where the data read from the PCAP is stored (NULL if
+*        nothing is read)
+* @param destination_words is the number of words to read
+*
+* @return   XST_SUCCESS else XST_FAILURE.
+*
+*****************************************************************************/
+int PCAP_Transfer(XDcfg *InstancePtr, u32 *source, u32 source_words, u32 *destination, u32 destination_words)
+{
+    int Status;
+    volatile u32 IntrStsReg = 0;
+
+    if (source != NULL)
+    {
+        Xil_DCacheFlushRange((UINTPTR) source, source_words*4);
+        Status = XDcfg_Transfer(InstancePtr, source, source_words, (u8*) XDCFG_DMA_INVALID_ADDRESS, 0, XDCFG_NON_SECURE_PCAP_WRITE);
+    }
+    else
+    {
+        Status = XDcfg_Transfer(InstancePtr, (u32*) XDCFG_DMA_INVALID_ADDRESS, destination_words, destination, destination_words, XDCFG_NON_SECURE_PCAP_WRITE);
+        Xil_DCacheInvalidateRange((UINTPTR) destination, destination_words*4);
+    }
+    if (Status != XST_SUCCESS)
+    {
+        return XST_FAILURE;
+    }
+    // Poll IXR_DMA_DONE
+    IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
+    while ((IntrStsReg & XDCFG_IXR_DMA_DONE_MASK) != XDCFG_IXR_DMA_DONE_MASK)
+    {
+        IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
+    }
+    // Poll IXR_D_P_DONE
+    while ((IntrStsReg & XDCFG_IXR_D_P_DONE_MASK) != XDCFG_IXR_D_P_DONE_MASK)
+    {
+        IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
+    }
+
+    // Clear the interrupt status bits
+    XDcfg_IntrClear(InstancePtr, (XDCFG_IXR_PCFG_DONE_MASK | XDCFG_IXR_D_P_DONE_MASK | XDCFG_IXR_DMA_DONE_MASK));
+
+    return XST_SUCCESS;
+}
+#endif // #ifndef PCAP_LINUX
+
+/****************************************************************************/
+/**
+*
+* Adds to a command buffer the words that start a configuration write: bus
+* width detection, synchronization, CRC reset and the ID register check.
+*
+* @param WriteBuffer is the command buffer
+*
+* @return   number of words added
+*
+*****************************************************************************/
+static u32 add_write_header(u32 *WriteBuffer)
+{
+    u32 Index = 0;
+
+    // Bus Width, DUMMY and SYNC
+    WriteBuffer[Index++] = PCAP_DUMMY_PACKET;
+    WriteBuffer[Index++] = PCAP_BW_SYNC;
+    WriteBuffer[Index++] = PCAP_BW_DETECT;
+    WriteBuffer[Index++] = PCAP_DUMMY_PACKET;
+    WriteBuffer[Index++] = PCAP_SYNC_PACKET;
+    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
+    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
+
+    // Reset CRC
+    WriteBuffer[Index++] = PCAP_Type1Write(PCAP_CMD) | 1;
+    WriteBuffer[Index++] = PCAP_CMD_RCRC;
+    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
+    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
+
+    // ID register
+    WriteBuffer[Index++] = PCAP_Type1Write(PCAP_IDCODE) | 1;
+    WriteBuffer[Index++] = fpga_device->idcode;
+
+    return Index;
+}
+
+/****************************************************************************/
+/**
+*
+* Adds to a command buffer the write configuration command, the FAR and the
+* FDRI packet header of a run of frames. The frame data follows the header.
+*
+* @param WriteBuffer is the command buffer
+* @param frame_address is the FAR of the first frame
+* @param TotalWords is the number of words written through FDRI
+*
+* @return   number of words added
+*
+*****************************************************************************/
+static u32 add_frames_header(u32 *WriteBuffer, u32 frame_address, u32 TotalWords)
+{
+    u32 Index = 0;
+
+    // Setup CMD register - write configuration
+    WriteBuffer[Index++] = PCAP_Type1Write(PCAP_CMD) | 1;
+    WriteBuffer[Index++] = PCAP_CMD_WCFG;
+    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
+
+    // Setup FAR
+    WriteBuffer[Index++] = PCAP_Type1Write(PCAP_FAR) | 1;
+    WriteBuffer[Index++] = frame_address;
+    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
+
+    // Setup Packet header
+    if (TotalWords < PCAP_TYPE_1_PACKET_MAX_WORDS)
+    {
+        // Create Type 1 Packet
+        WriteBuffer[Index++] = PCAP_Type1Write(PCAP_FDRI) | TotalWords;
+    }
+    else
+    {
+        // Create Type 2 Packet
+        WriteBuffer[Index++] = PCAP_Type1Write(PCAP_FDRI);
+        WriteBuffer[Index++] = PCAP_TYPE_2_WRITE | TotalWords;
+    }
+
+    return Index;
+}
+
+/****************************************************************************/
+/**
+*
+* Adds to a command buffer the words that end a configuration write: CRC
+* reset and desynchronization.
+*
+* @param WriteBuffer is the command buffer
+*
+* @return   number of words added
+*
+*****************************************************************************/
+static u32 add_write_trailer(u32 *WriteBuffer)
+{
+    u32 Index = 0;
+
+    // Add CRC
+    WriteBuffer[Index++] = PCAP_Type1Write(PCAP_CMD) | 1;
+    WriteBuffer[Index++] = PCAP_CMD_RCRC;
+    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
+    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
+
+    // DESYNC
+    WriteBuffer[Index++] = PCAP_Type1Write(PCAP_CMD) | 1;
+    WriteBuffer[Index++] = PCAP_CMD_DESYNCH;
+    WriteBuffer[Index++] = PCAP_DUMMY_PACKET;
+    WriteBuffer[Index++] = PCAP_DUMMY_PACKET;
+
+    return Index;
+}
+
 /****************************************************************************/
 /**
 *
@@ -298,15 +520,12 @@ int PCAP_Initialize(XDcfg *InstancePtr, u16 DeviceId)
 * @return   XST_SUCCESS else XST_FAILURE.
 *
 *****************************************************************************/
-int PCAP_RAM_write(XDcfg *InstancePtr, u32 *addr_start, u32 addr_end, u32 x0, u32 y0, u32 xf, u32 yf, u32 erase_bram)
+int PCAP_RAM_write(XDcfg *InstancePtr, u32 *addr_start, UINTPTR addr_end, u32 x0, u32 y0, u32 xf, u32 yf, u32 erase_bram)
 {
 	u32 Index =0;
-	u32 Packet;
-    u32 Data;
     u32 TotalWords;
     int Status;
     static u32 WriteBuffer[READ_FRAME_SIZE];
-    volatile u32 IntrStsReg = 0;
 
 #ifdef PCAP_TIMING
     XTime time, transfer; // Elapsed time local variable
@@ -324,94 +543,29 @@ int PCAP_RAM_write(XDcfg *InstancePtr, u32 *addr_start, u32 addr_end, u32 x0, u3
     *(volatile u32*)(SLCR_LOCK) = SLCR_LOCK_VAL;
 #endif // #ifdef PCAP_CLK_RW
 
-    // Bus Width, DUMMY and SYNC
-    WriteBuffer[Index++] = PCAP_DUMMY_PACKET;
-    WriteBuffer[Index++] = PCAP_BW_SYNC;
-    WriteBuffer[Index++] = PCAP_BW_DETECT;
-    WriteBuffer[Index++] = PCAP_DUMMY_PACKET;
-    WriteBuffer[Index++] = PCAP_SYNC_PACKET;
-    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
-    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
-
-    // Reset CRC
-    Packet = PCAP_Type1Write(PCAP_CMD) | 1;
-    Data = PCAP_CMD_RCRC;
-    WriteBuffer[Index++] = Packet;
-    WriteBuffer[Index++] = Data;
-    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
-    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
-
-    // ID register
-    Packet = PCAP_Type1Write(PCAP_IDCODE) | 1;
-    Data = PCAP_IDCODE_NUMBER;
-    WriteBuffer[Index++] = Packet;
-    WriteBuffer[Index++] = Data;
+    // Bus Width, DUMMY, SYNC, CRC reset and ID register
+    Index = add_write_header(WriteBuffer);
 
     // Repeat for each clock region
     u32 *addr_send = addr_start;
     int x, y;
     for(y = y0; y <= yf; y++)
     {
-        // Setup CMD register - write configuration
-        Packet = PCAP_Type1Write(PCAP_CMD) | 1;
-        Data = PCAP_CMD_WCFG;
-        WriteBuffer[Index++] = Packet;
-        WriteBuffer[Index++] = Data;
-        WriteBuffer[Index++] = PCAP_NOOP_PACKET;
-
-        // Setup FAR
-        Packet = PCAP_Type1Write(PCAP_FAR) | 1;
-        Data = PCAP_SetupFar7S((fpga[y][x0][0] & (0xFF << 24))>>24, PCAP_FAR_CLB_BLOCK, (fpga[y][x0][0] & (0xFF << 16))>>16, x0, 0);
-        WriteBuffer[Index++] = Packet;
-        WriteBuffer[Index++] = Data;
-        WriteBuffer[Index++] = PCAP_NOOP_PACKET;
-
-        // Setup Packet header
-        TotalWords = 0;
-        for(x = x0; x <= xf; x++)
-        {
-            TotalWords += (fpga[y][x][0] & 0xFFFF) * NUM_FRAME_WORDS;
-        }
-        TotalWords += NUM_FRAME_WORDS;//We add a padding frame
-
-        if (TotalWords < PCAP_TYPE_1_PACKET_MAX_WORDS)
-        {
-            // Create Type 1 Packet
-            Packet = PCAP_Type1Write(PCAP_FDRI) | TotalWords;
-            WriteBuffer[Index++] = Packet;
-        }
-        else
-        {
-            // Create Type 2 Packet
-            Packet = PCAP_Type1Write(PCAP_FDRI);
-            WriteBuffer[Index++] = Packet;
-
-            Packet = PCAP_TYPE_2_WRITE | TotalWords;
-            WriteBuffer[Index++] = Packet;
-        }
+        // Write configuration from the first frame of the row
+        TotalWords = FRAMES_IN_COLUMNS(y, x0, xf) * FRAME_WORDS;
+        TotalWords += FRAME_WORDS;//We add a padding frame
+        Index += add_frames_header(&WriteBuffer[Index], PCAP_SetupFarRow(PCAP_FAR_CLB_BLOCK, y, x0, 0), TotalWords);
 
 #ifdef PCAP_TIMING
         XTime_GetTime(&time); // Get time count
 #endif // #ifdef PCAP_TIMING
 
         // Write header data.
-        Xil_DCacheFlushRange(WriteBuffer, Index*4);
-        Status = XDcfg_Transfer(InstancePtr, WriteBuffer, Index, (u8*) XDCFG_DMA_INVALID_ADDRESS, 0, XDCFG_NON_SECURE_PCAP_WRITE);
+        Status = PCAP_Transfer(InstancePtr, WriteBuffer, Index, NULL, 0);
         if (Status != XST_SUCCESS)
         {
             return XST_FAILURE;
         }
-        // Poll IXR_DMA_DONE
-        IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-        while ((IntrStsReg & XDCFG_IXR_DMA_DONE_MASK) != XDCFG_IXR_DMA_DONE_MASK)
-        {
-            IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-        }
-        // Poll IXR_D_P_DONE
-        while ((IntrStsReg & XDCFG_IXR_D_P_DONE_MASK) != XDCFG_IXR_D_P_DONE_MASK)
-        {
-            IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-        }
 
 #ifdef PCAP_TIMING
         XTime_GetTime(&transfer); // Get time count
@@ -419,31 +573,16 @@ int PCAP_RAM_write(XDcfg *InstancePtr, u32 *addr_start, u32 addr_end, u32 x0, u3
         printf("PCAP Bandwidth:                   %12.3f MB/s\n", ((float)Index*4)/((float)(transfer-time)*1000000/(XPAR_PS7_CORTEXA9_0_CPU_CLK_FREQ_HZ/2)));
 #endif // #ifdef PCAP_TIMING
 
-        // Clear the interrupt status bits
-        XDcfg_IntrClear(InstancePtr, (XDCFG_IXR_PCFG_DONE_MASK | XDCFG_IXR_D_P_DONE_MASK | XDCFG_IXR_DMA_DONE_MASK));
-
 #ifdef PCAP_TIMING
         XTime_GetTime(&time); // Get time count
 #endif // #ifdef PCAP_TIMING
 
         // Write the frame data.
-        Xil_DCacheFlushRange(addr_send, TotalWords*4);
-        Status = XDcfg_Transfer(InstancePtr, addr_send, TotalWords, (u8*) XDCFG_DMA_INVALID_ADDRESS, 0, XDCFG_NON_SECURE_PCAP_WRITE);
+        Status = PCAP_Transfer(InstancePtr, addr_send, TotalWords, NULL, 0);
         if (Status != XST_SUCCESS)
         {
             return XST_FAILURE;
         }
-        // Poll IXR_DMA_DONE
-        IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-        while ((IntrStsReg & XDCFG_IXR_DMA_DONE_MASK) != XDCFG_IXR_DMA_DONE_MASK)
-        {
-            IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-        }
-        // Poll IXR_D_P_DONE
-        while ((IntrStsReg & XDCFG_IXR_D_P_DONE_MASK) != XDCFG_IXR_D_P_DONE_MASK)
-        {
-            IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-        }
 
 #ifdef PCAP_TIMING
         XTime_GetTime(&transfer); // Get time count
@@ -451,17 +590,14 @@ int PCAP_RAM_write(XDcfg *InstancePtr, u32 *addr_start, u32 addr_end, u32 x0, u3
         printf("PCAP Bandwidth:                   %12.3f MB/s\n", ((float)TotalWords*4)/((float)(transfer-time)*1000000/(XPAR_PS7_CORTEXA9_0_CPU_CLK_FREQ_HZ/2)));
 #endif // #ifdef PCAP_TIMING
 
-        // Clear the interrupt status bits
-        XDcfg_IntrClear(InstancePtr, (XDCFG_IXR_PCFG_DONE_MASK | XDCFG_IXR_D_P_DONE_MASK | XDCFG_IXR_DMA_DONE_MASK));
-
         // Reset command buffer index
         Index = 0;
 
         // Increment initial address
-        addr_send = (u32*) ((u32) addr_send + (TotalWords  * BYTES_PER_WORD_OF_FRAME));
+        addr_send = (u32*) ((UINTPTR) addr_send + (TotalWords  * BYTES_PER_WORD_OF_FRAME));
 
         // Security check. We add a padding frame to the addr end
-        if((u32)addr_send > (addr_end + NUM_FRAME_WORDS*BYTES_PER_WORD_OF_FRAME))
+        if((UINTPTR) addr_send > (addr_end + FRAME_WORDS*BYTES_PER_WORD_OF_FRAME))
         {
         	return XST_FAILURE;
         }
@@ -469,9 +605,11 @@ int PCAP_RAM_write(XDcfg *InstancePtr, u32 *addr_start, u32 addr_end, u32 x0, u3
 
     // Erase BRAM contents if required
     if (erase_bram == PCAP_BRAM_ERASE) {
-        u32 null_frame[128*NUM_FRAME_WORDS];
-        for (Index = 0; Index < 128; Index++) null_frame[Index] = 0;
-        Index = 0;
+        static u32 null_frame[MAX_BRAM_CONTENT_FRAMES*MAX_FRAME_WORDS];
+        // The buffer is sized for the families in devices[]
+        if (DEVICE_FAMILY->bram_content_frames > MAX_BRAM_CONTENT_FRAMES) {
+            return XST_FAILURE;
+        }
         // Repeat for each clock region
         for (y = y0; y <= yf; y++)
         {
@@ -479,82 +617,24 @@ int PCAP_RAM_write(XDcfg *InstancePtr, u32 *addr_start, u32 addr_end, u32 x0, u3
             for (x = x0; x <= xf; x++)
             {
                 // Check if the column is a BRAM column
-                if (((fpga_bram[y][x] & 0xFFFF0000)>>16) == BRAM_CONTENT) {
-                    // Setup CMD register - write configuration
-                    Packet = PCAP_Type1Write(PCAP_CMD) | 1;
-                    Data = PCAP_CMD_WCFG;
-                    WriteBuffer[Index++] = Packet;
-                    WriteBuffer[Index++] = Data;
-                    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
-
-                    // Setup FAR
-                    Packet = PCAP_Type1Write(PCAP_FAR) | 1;
-                    Data = PCAP_SetupFar7S((fpga[y][x][0] & (0xFF << 24))>>24, PCAP_FAR_BRAM_BLOCK, (fpga[y][x][0] & (0xFF << 16))>>16, fpga_bram[y][x] & 0xFFFF, 0);
-                    WriteBuffer[Index++] = Packet;
-                    WriteBuffer[Index++] = Data;
-                    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
-
-                    // Setup Packet header
-                    TotalWords = 128 * NUM_FRAME_WORDS;
-                    if (TotalWords < PCAP_TYPE_1_PACKET_MAX_WORDS)
-                    {
-                        // Create Type 1 Packet
-                        Packet = PCAP_Type1Write(PCAP_FDRI) | TotalWords;
-                        WriteBuffer[Index++] = Packet;
-                    }
-                    else
-                    {
-                        // Create Type 2 Packet
-                        Packet = PCAP_Type1Write(PCAP_FDRI);
-                        WriteBuffer[Index++] = Packet;
-
-                        Packet = PCAP_TYPE_2_WRITE | TotalWords;
-                        WriteBuffer[Index++] = Packet;
-                    }
+                if (DEVICE_BRAM_MAJOR(y, x) != DEVICE_NO_BRAM) {
+                    // Write configuration from the first frame of the BRAM contents
+                    TotalWords = DEVICE_FAMILY->bram_content_frames * FRAME_WORDS;
+                    Index += add_frames_header(&WriteBuffer[Index], PCAP_SetupFarRow(PCAP_FAR_BRAM_BLOCK, y, DEVICE_BRAM_MAJOR(y, x), 0), TotalWords);
 
                     // Write header data.
-                    Xil_DCacheFlushRange(WriteBuffer, Index*4);
-                    Status = XDcfg_Transfer(InstancePtr, WriteBuffer, Index, (u8*) XDCFG_DMA_INVALID_ADDRESS, 0, XDCFG_NON_SECURE_PCAP_WRITE);
+                    Status = PCAP_Transfer(InstancePtr, WriteBuffer, Index, NULL, 0);
                     if (Status != XST_SUCCESS)
                     {
                         return XST_FAILURE;
                     }
-                    // Poll IXR_DMA_DONE
-                    IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-                    while ((IntrStsReg & XDCFG_IXR_DMA_DONE_MASK) != XDCFG_IXR_DMA_DONE_MASK)
-                    {
-                        IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-                    }
-                    // Poll IXR_D_P_DONE
-                    while ((IntrStsReg & XDCFG_IXR_D_P_DONE_MASK) != XDCFG_IXR_D_P_DONE_MASK)
-                    {
-                        IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-                    }
-
-                    // Clear the interrupt status bits
-                    XDcfg_IntrClear(InstancePtr, (XDCFG_IXR_PCFG_DONE_MASK | XDCFG_IXR_D_P_DONE_MASK | XDCFG_IXR_DMA_DONE_MASK));
 
                     // Write the frame data.
-                    Xil_DCacheFlushRange(null_frame, TotalWords*4);
-                    Status = XDcfg_Transfer(InstancePtr, null_frame, TotalWords, (u8*) XDCFG_DMA_INVALID_ADDRESS, 0, XDCFG_NON_SECURE_PCAP_WRITE);
+                    Status = PCAP_Transfer(InstancePtr, null_frame, TotalWords, NULL, 0);
                     if (Status != XST_SUCCESS)
                     {
                         return XST_FAILURE;
                     }
-                    // Poll IXR_DMA_DONE
-                    IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-                    while ((IntrStsReg & XDCFG_IXR_DMA_DONE_MASK) != XDCFG_IXR_DMA_DONE_MASK)
-                    {
-                        IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-                    }
-                    // Poll IXR_D_P_DONE
-                    while ((IntrStsReg & XDCFG_IXR_D_P_DONE_MASK) != XDCFG_IXR_D_P_DONE_MASK)
-                    {
-                        IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-                    }
-
-                    // Clear the interrupt status bits
-                    XDcfg_IntrClear(InstancePtr, (XDCFG_IXR_PCFG_DONE_MASK | XDCFG_IXR_D_P_DONE_MASK | XDCFG_IXR_DMA_DONE_MASK));
 
                     // Reset command buffer index
                     Index = 0;
@@ -563,44 +643,19 @@ int PCAP_RAM_write(XDcfg *InstancePtr, u32 *addr_start, u32 addr_end, u32 x0, u3
         }
     }
 
-    // Add CRC
-    Packet = PCAP_Type1Write(PCAP_CMD) | 1;
-    Data = PCAP_CMD_RCRC;
-    WriteBuffer[Index++] = Packet;
-    WriteBuffer[Index++] = Data;
-    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
-    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
-
-    // DESYNC
-    Packet = (PCAP_Type1Write(PCAP_CMD) | 1);
-    Data = PCAP_CMD_DESYNCH;
-    WriteBuffer[Index++] = Packet;
-    WriteBuffer[Index++] = Data;
-    WriteBuffer[Index++] = PCAP_DUMMY_PACKET;
-    WriteBuffer[Index++] = PCAP_DUMMY_PACKET;
+    // CRC reset and DESYNC
+    Index += add_write_trailer(&WriteBuffer[Index]);
 
 #ifdef PCAP_TIMING
     XTime_GetTime(&time); // Get time count
 #endif // #ifdef PCAP_TIMING
 
     // Write the frame data.
-    Xil_DCacheFlushRange(WriteBuffer, Index*4);
-    Status = XDcfg_Transfer(InstancePtr, WriteBuffer, Index, (u8*) XDCFG_DMA_INVALID_ADDRESS, 0, XDCFG_NON_SECURE_PCAP_WRITE);
+    Status = PCAP_Transfer(InstancePtr, WriteBuffer, Index, NULL, 0);
     if (Status != XST_SUCCESS)
     {
         return XST_FAILURE;
     }
-    // Poll IXR_DMA_DONE
-    IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-    while ((IntrStsReg & XDCFG_IXR_DMA_DONE_MASK) != XDCFG_IXR_DMA_DONE_MASK)
-    {
-        IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-    }
-    // Poll IXR_D_P_DONE
-    while ((IntrStsReg & XDCFG_IXR_D_P_DONE_MASK) != XDCFG_IXR_D_P_DONE_MASK)
-    {
-        IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-    }
 
 #ifdef PCAP_TIMING
     XTime_GetTime(&transfer); // Get time count
@@ -608,9 +663,6 @@ int PCAP_RAM_write(XDcfg *InstancePtr, u32 *addr_start, u32 addr_end, u32 x0, u3
     printf("PCAP Bandwidth:                   %12.3f MB/s\n", ((float)Index*4)/((float)(transfer-time)*1000000/(XPAR_PS7_CORTEXA9_0_CPU_CLK_FREQ_HZ/2)));
 #endif // #ifdef PCAP_TIMING
 
-    // Clear the interrupt status bits
-    XDcfg_IntrClear(InstancePtr, (XDCFG_IXR_PCFG_DONE_MASK | XDCFG_IXR_D_P_DONE_MASK | XDCFG_IXR_DMA_DONE_MASK));
-
 #ifdef PCAP_TIMING
     XTime_GetTime(&time); // Get time count
     printf("PCAP_DeviceWritePBS elapsed time: %12.3f us (%10.0f cycles @ %7.3f MHz)\n", ((float)time)/(XPAR_PS7_CORTEXA9_0_CPU_CLK_FREQ_HZ/2)*1000000, (float)time, (float)(XPAR_PS7_CORTEXA9_0_CPU_CLK_FREQ_HZ/2)/1000000);
@@ -619,6 +671,75 @@ int PCAP_RAM_write(XDcfg *InstancePtr, u32 *addr_start, u32 addr_end, u32 x0, u3
     return XST_SUCCESS;
 }
 
+/****************************************************************************/
+/**
+*
+* Writes runs of consecutive frames using PCAP interface
+*
+* @param InstancePtr is a pointer to the PCAP instance.
+* @param frame_address is the FAR of the first frame of each run
+* @param num_frames is the number of frames of each run
+* @param num_runs is the number of runs
+* @param frames is a pointer to the frames of all the runs. Each run is
+*        followed by a padding frame
+*
+* @return   XST_SUCCESS else XST_FAILURE.
+*
+*****************************************************************************/
+int PCAP_write_frames(XDcfg *InstancePtr, u32 *frame_address, u32 *num_frames, u32 num_runs, u32 *frames)
+{
+    u32 Index = 0;
+    u32 TotalWords;
+    u32 run;
+    int Status;
+    static u32 WriteBuffer[READ_FRAME_SIZE];
+
+    Xil_AssertNonvoid(InstancePtr != NULL);
+    Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+    Xil_AssertNonvoid(frames != NULL);
+
+#ifdef PCAP_CLK_RW
+    // Change PCAP clock configuration
+    *(volatile u32*)(SLCR_UNLOCK) = SLCR_UNLOCK_VAL;
+    *(volatile u32*)(SLCR_PCAP_CLK_CTRL) = ((PCAP_CLK_DIVISOR_WRITE & 0x3F) << 8) | ((PCAP_CLK_SOURCE & 0x3) << 4) | 0x1;
+    *(volatile u32*)(SLCR_LOCK) = SLCR_LOCK_VAL;
+#endif // #ifdef PCAP_CLK_RW
+
+    // Bus Width, DUMMY, SYNC, CRC reset and ID register
+    Index = add_write_header(WriteBuffer);
+
+    // Repeat for each run
+    for (run = 0; run < num_runs; run++)
+    {
+        // Write configuration from the first frame of the run
+        TotalWords = (num_frames[run] + 1) * FRAME_WORDS; //We add a padding frame
+        Index += add_frames_header(&WriteBuffer[Index], frame_address[run], TotalWords);
+
+        // Write header data.
+        Status = PCAP_Transfer(InstancePtr, WriteBuffer, Index, NULL, 0);
+        if (Status != XST_SUCCESS)
+        {
+            return XST_FAILURE;
+        }
+
+        // Write the frame data.
+        Status = PCAP_Transfer(InstancePtr, frames, TotalWords, NULL, 0);
+        if (Status != XST_SUCCESS)
+        {
+            return XST_FAILURE;
+        }
+
+        // Reset command buffer index
+        Index = 0;
+        frames += TotalWords;
+    }
+
+    // CRC reset and DESYNC
+    Index += add_write_trailer(&WriteBuffer[Index]);
+
+    return PCAP_Transfer(InstancePtr, WriteBuffer, Index, NULL, 0);
+}
+
 /****************************************************************************/
 /**
 *
@@ -639,7 +760,6 @@ int PCAP_RAM_read(XDcfg *InstancePtr, u32 **addr_start, u32 x0, u32 y0, u32 xf,
     int Status;
     static u32 WriteBuffer[READ_FRAME_SIZE];
     u32 Index = 0;
-    volatile u32 IntrStsReg = 0;
     u32 TotalWords = 0;
 
 #ifdef PCAP_TIMING
@@ -659,7 +779,7 @@ int PCAP_RAM_read(XDcfg *InstancePtr, u32 **addr_start, u32 x0, u32 y0, u32 xf,
 #endif // #ifdef PCAP_CLK_RW
 
     // Repeat for each clock region
-    int x, y;
+    int y;
     for(y = y0; y <= yf; y++)
     {
         // Bus Width, DUMMY and SYNC
@@ -687,17 +807,13 @@ int PCAP_RAM_read(XDcfg *InstancePtr, u32 **addr_start, u32 x0, u32 y0, u32 xf,
 
         // Setup FAR register
         Packet = PCAP_Type1Write(PCAP_FAR) | 1;
-        Data = PCAP_SetupFar7S((fpga[y][x0][0] & (0xFF << 24))>>24, PCAP_FAR_CLB_BLOCK, (fpga[y][x0][0] & (0xFF << 16))>>16, x0, 0);
+        Data = PCAP_SetupFarRow(PCAP_FAR_CLB_BLOCK, y, x0, 0);
         WriteBuffer[Index++] = Packet;
         WriteBuffer[Index++] = Data;
         WriteBuffer[Index++] = PCAP_NOOP_PACKET;
 
         // Set up packet header
-        TotalWords = NUM_FRAME_WORDS;
-        for(x = x0; x <= xf; x++)
-        {
-            TotalWords += (fpga[y][x][0] & 0xFFFF) * NUM_FRAME_WORDS;
-        }
+        TotalWords = FRAME_WORDS + FRAMES_IN_COLUMNS(y, x0, xf) * FRAME_WORDS;
         if (TotalWords < PCAP_TYPE_1_PACKET_MAX_WORDS)
         {
             // Create Type 1 Packet
@@ -730,24 +846,11 @@ int PCAP_RAM_read(XDcfg *InstancePtr, u32 **addr_start, u32 x0, u32 y0, u32 xf,
         XTime_GetTime(&time); // Get time count
 #endif // #ifdef PCAP_TIMING
 
-        Xil_DCacheFlushRange(WriteBuffer, Index*4);
-        Status = XDcfg_Transfer(InstancePtr, WriteBuffer, Index, (u32*) XDCFG_DMA_INVALID_ADDRESS, 0, XDCFG_NON_SECURE_PCAP_WRITE);
-        //Status = XDcfg_Transfer(InstancePtr, WriteBuffer, Index, (u8*) XDCFG_DMA_INVALID_ADDRESS, 0, XDCFG_NON_SECURE_PCAP_WRITE);
+        Status = PCAP_Transfer(InstancePtr, WriteBuffer, Index, NULL, 0);
         if (Status != XST_SUCCESS)
         {
         return XST_FAILURE;
         }
-        // Poll IXR_DMA_DONE
-        IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-        while ((IntrStsReg & XDCFG_IXR_DMA_DONE_MASK) != XDCFG_IXR_DMA_DONE_MASK)
-        {
-        IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-        }
-        // Poll IXR_D_P_DONE
-        while ((IntrStsReg & XDCFG_IXR_D_P_DONE_MASK) != XDCFG_IXR_D_P_DONE_MASK)
-        {
-        IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-        }
 
 #ifdef PCAP_TIMING
         XTime_GetTime(&transfer); // Get time count
@@ -756,31 +859,11 @@ int PCAP_RAM_read(XDcfg *InstancePtr, u32 **addr_start, u32 x0, u32 y0, u32 xf,
         XTime_GetTime(&time); // Get time count
 #endif // #ifdef PCAP_TIMING
 
-        // Clear the interrupt status bits
-        XDcfg_IntrClear(InstancePtr, (XDCFG_IXR_PCFG_DONE_MASK | XDCFG_IXR_D_P_DONE_MASK | XDCFG_IXR_DMA_DONE_MASK));
-
-
-
-
-        Status = XDcfg_Transfer(InstancePtr, (u32*) XDCFG_DMA_INVALID_ADDRESS, TotalWords, *addr_start, TotalWords, XDCFG_NON_SECURE_PCAP_WRITE);
-        //Status = XDcfg_Transfer(InstancePtr, (u8*) XDCFG_DMA_INVALID_ADDRESS, TotalWords, 0, TotalWords, XDCFG_NON_SECURE_PCAP_WRITE);
-        Xil_DCacheInvalidateRange(*addr_start, TotalWords*4);
+        Status = PCAP_Transfer(InstancePtr, NULL, 0, *addr_start, TotalWords);
         if (Status != XST_SUCCESS)
         {
         return XST_FAILURE;
         }
-        // Poll IXR_DMA_DONE
-        IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-
-        while ((IntrStsReg & XDCFG_IXR_DMA_DONE_MASK) != XDCFG_IXR_DMA_DONE_MASK)
-        {
-        IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-        }
-        // Poll IXR_D_P_DONE
-        while ((IntrStsReg & XDCFG_IXR_D_P_DONE_MASK) != XDCFG_IXR_D_P_DONE_MASK)
-        {
-        IntrStsReg = XDcfg_IntrGetStatus(InstancePtr);
-        }
 
 #ifdef PCAP_TIMING
         XTime_GetTime(&transfer); // Get time count
@@ -788,18 +871,14 @@ int PCAP_RAM_read(XDcfg *InstancePtr, u32 **addr_start, u32 x0, u32 y0, u32 xf,
         printf("PCAP Bandwidth:                   %12.3f MB/s\n", ((float)TotalWords*4)/((float)(transfer-time)*1000000/(XPAR_PS7_CORTEXA9_0_CPU_CLK_FREQ_HZ/2)));
 #endif // #ifdef PCAP_TIMING
 
-
-        // Clear the interrupt status bits
-        XDcfg_IntrClear(InstancePtr, (XDCFG_IXR_PCFG_DONE_MASK | XDCFG_IXR_D_P_DONE_MASK | XDCFG_IXR_DMA_DONE_MASK));
-
         /* 2 explicit DMA transfers */
 
         // Erase NULL frame
-        memmove(*addr_start, *addr_start+NUM_FRAME_WORDS, (TotalWords-NUM_FRAME_WORDS)*BYTES_PER_WORD_OF_FRAME);
+        memmove(*addr_start, *addr_start+FRAME_WORDS, (TotalWords-FRAME_WORDS)*BYTES_PER_WORD_OF_FRAME);
         // Reset command buffer index
         Index = 0;
         // Increment initial address
-        *addr_start = (u32*) ((u32) *addr_start + (TotalWords- (u32) NUM_FRAME_WORDS) * BYTES_PER_WORD_OF_FRAME);
+        *addr_start = (u32*) ((UINTPTR) *addr_start + (TotalWords- (u32) FRAME_WORDS) * BYTES_PER_WORD_OF_FRAME);
     }
 
 #ifdef PCAP_TIMING
@@ -810,6 +889,89 @@ int PCAP_RAM_read(XDcfg *InstancePtr, u32 **addr_start, u32 x0, u32 y0, u32 xf,
     return XST_SUCCESS;
 }
 
+/****************************************************************************/
+/**
+*
+* Reads the IDCODE register of the device through the PCAP
+*
+* @param InstancePtr is a pointer to the PCAP instance.
+* @param idcode is where the IDCODE is stored
+*
+* @return   XST_SUCCESS else XST_FAILURE.
+*
+*****************************************************************************/
+int PCAP_read_IDCODE(XDcfg *InstancePtr, u32 *idcode)
+{
+    static u32 WriteBuffer[32] __attribute__ ((aligned (32)));
+    static u32 ReadBuffer[8] __attribute__ ((aligned (32)));
+    u32 Index = 0;
+    int Status;
+
+    // Bus Width, DUMMY and SYNC
+    WriteBuffer[Index++] = PCAP_DUMMY_PACKET;
+    WriteBuffer[Index++] = PCAP_BW_SYNC;
+    WriteBuffer[Index++] = PCAP_BW_DETECT;
+    WriteBuffer[Index++] = PCAP_DUMMY_PACKET;
+    WriteBuffer[Index++] = PCAP_SYNC_PACKET;
+    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
+    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
+
+    // Read IDCODE register
+    WriteBuffer[Index++] = PCAP_Type1Read(PCAP_IDCODE) | 1;
+    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
+    WriteBuffer[Index++] = PCAP_NOOP_PACKET;
+
+    // DESYNC
+    WriteBuffer[Index++] = PCAP_Type1Write(PCAP_CMD) | 1;
+    WriteBuffer[Index++] = PCAP_CMD_DESYNCH;
+    WriteBuffer[Index++] = PCAP_DUMMY_PACKET;
+    WriteBuffer[Index++] = PCAP_DUMMY_PACKET;
+
+    Status = PCAP_Transfer(InstancePtr, WriteBuffer, Index, NULL, 0);
+    if (Status != XST_SUCCESS)
+    {
+        return XST_FAILURE;
+    }
+    Status = PCAP_Transfer(InstancePtr, NULL, 0, ReadBuffer, 1);
+    if (Status != XST_SUCCESS)
+    {
+        return XST_FAILURE;
+    }
+
+    *idcode = ReadBuffer[0];
+    return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Obtains the RAM used from addr_start by write_subclock_region_PBS to read
+* back a region before the new PBS is placed after it
+*
+* @param pblock_list[] array with the pblocks of the region
+* @param num_pblocks total number of pblocks in the array.
+*
+* @return   bytes used by the readback
+*
+*****************************************************************************/
+u32 PCAP_staging_bytes(pblock pblock_list[], u32 num_pblocks)
+{
+    u32 i, frames;
+    int y;
+
+    // The readback of each row needs an additional frame and the write a padding frame
+    frames = 1;
+    for (i = 0; i < num_pblocks; i++)
+    {
+        for (y = pblock_list[i].Y0 / CLOCK_REGION_ROWS; y <= pblock_list[i].Yf / CLOCK_REGION_ROWS; y++)
+        {
+            frames += 2 + FRAMES_IN_COLUMNS(y, pblock_list[i].X0, pblock_list[i].Xf);
+        }
+    }
+
+    return frames * FRAME_BYTES;
+}
+
 
 
 /****************************************************************************/
@@ -833,7 +995,7 @@ int PCAP_RAM_read(XDcfg *InstancePtr, u32 **addr_start, u32 x0, u32 y0, u32 xf,
 * reconfigured
 * @param pblock_list[] array with the pblock where the bitstream will be
 * reconfigured
-* @param num_pblocks total number of pblocks in the array.
+* @param num_pblocks total number of pblocks in the array (up to PCAP_MAX_PBLOCKS).
 * @param erase_bram boolean. Erase BRAM contents if required.
 * @param stacked_modules : this value can be used when reconfiguring several
 * modules that are stacked in the same columns. If this parameter is set to 0
@@ -847,6 +1009,38 @@ int PCAP_RAM_read(XDcfg *InstancePtr, u32 **addr_start, u32 x0, u32 y0, u32 xf,
 *
 *****************************************************************************/
 int write_subclock_region_PBS(XDcfg *InstancePtr, u32 *addr_start, const char *file_name, pblock pblock_list[], u32 num_pblocks, u32 erase_bram, u8 stacked_modules) {
+	Xil_AssertNonvoid(file_name != NULL);
+	return write_subclock_region(InstancePtr, addr_start, file_name, NULL, 0, pblock_list, num_pblocks, erase_bram, stacked_modules);
+}
+
+/****************************************************************************/
+/**
+*
+* This function is equivalent to write_subclock_region_PBS but the partial
+* bitstream has already been loaded in RAM (e.g. by a PBS cache). The PBS is
+* not modified so it can be reused in later reconfigurations.
+*
+* @param InstancePtr: is a pointer to the PCAP instance.
+* @param addr_start: is a pointer to free memory address used to read back the
+* region to reconfigure. It must not overlap the PBS.
+* @param PBS_addr: first RAM position of the PBS
+* @param PBS_last_addr: last RAM position of the PBS (as returned by
+* load_bitstream_from_SD_to_RAM)
+* @param pblock_list[] array with the pblock where the bitstream will be
+* reconfigured
+* @param num_pblocks total number of pblocks in the array.
+* @param erase_bram boolean. Erase BRAM contents if required.
+* @param stacked_modules: see write_subclock_region_PBS
+*
+* @return XST_SUCCESS else XST_FAILURE.
+*
+*****************************************************************************/
+int write_subclock_region_PBS_from_RAM(XDcfg *InstancePtr, u32 *addr_start, u32 *PBS_addr, UINTPTR PBS_last_addr, pblock pblock_list[], u32 num_pblocks, u32 erase_bram, u8 stacked_modules) {
+	Xil_AssertNonvoid(PBS_addr != NULL);
+	return write_subclock_region(InstancePtr, addr_start, NULL, PBS_addr, PBS_last_addr, pblock_list, num_pblocks, erase_bram, stacked_modules);
+}
+
+static int write_subclock_region(XDcfg *InstancePtr, u32 *addr_start, const char *file_name, u32 *PBS_addr, UINTPTR PBS_last_addr, pblock pblock_list[], u32 num_pblocks, u32 erase_bram, u8 stacked_modules) {
 	int initial_clock_region_row, final_clock_region_row, words_per_half_clock_region_without_clock;
 	int first_rows_not_used, first_words_not_used, last_rows_not_used, last_words_not_used;
 	int first_half_bytes_to_move, first_half_first_unused_bytes, last_half_bytes_to_move, last_half_first_unused_bytes;
@@ -864,6 +1058,17 @@ int write_subclock_region_PBS(XDcfg *InstancePtr, u32 *addr_start, const char *f
 	Xil_AssertNonvoid(num_pblocks);
 	Xil_AssertNonvoid(stacked_modules <= 3);
 
+	if (num_pblocks > PCAP_MAX_PBLOCKS) {
+		return XST_FAILURE;
+	}
+
+	// The rows of each pblock have to fill whole words of the frames
+	for (i = 0; i < num_pblocks; i++) {
+		if (pblock_list[i].Y0 % DEVICE_FAMILY->group_rows != 0 || (pblock_list[i].Yf + 1) % DEVICE_FAMILY->group_rows != 0) {
+			return XST_FAILURE;
+		}
+	}
+
 	// XTime time, transfer; // Elapsed time local variable
 	// XTime_SetTime(0);     // Initialize time count
   // 
@@ -881,19 +1086,34 @@ int write_subclock_region_PBS(XDcfg *InstancePtr, u32 *addr_start, const char *f
 			yf = pblock_list[i].Yf;
 
 
-			initial_clock_region_row = (int) y0 / (int) ROWS_PER_CLOCK_REGION;
-			final_clock_region_row = (int) yf / (int) ROWS_PER_CLOCK_REGION;
+			initial_clock_region_row = (int) y0 / (int) CLOCK_REGION_ROWS;
+			final_clock_region_row = (int) yf / (int) CLOCK_REGION_ROWS;
 
 			for(y = initial_clock_region_row; y <= final_clock_region_row; y++) {
 			  pblock_addr[reconfigurable_regions++] = previous_PBS_last_addr;
 			  if (reconfigurable_regions >= MAX_RECONFIGURABLE_CLOCK_REGIONS) {
 				return XST_FAILURE;
 			  }
+#ifdef PCAP_CLOCK_WORDS_CACHE
+			  /**
+			  * If the pblock covers the whole clock region row the new PBS replaces every word
+			  * except the clock words. When they are known the readback is not needed.
+			  */
+			  if ((y != initial_clock_region_row || y0 % CLOCK_REGION_ROWS == 0) &&
+			      (y != final_clock_region_row || yf % CLOCK_REGION_ROWS == CLOCK_REGION_ROWS - 1)) {
+				if (load_clock_words(&previous_PBS_last_addr, y, x0, xf) == XST_SUCCESS) {
+				  continue;
+				}
+			  }
+#endif
 			  //We read the actual content on the FPGA and save it on the RAM memory
 			  status = PCAP_RAM_read(InstancePtr, &previous_PBS_last_addr, x0, y, xf, y);
 			  if (status != XST_SUCCESS) {
 				return XST_FAILURE;
 			  }
+#ifdef PCAP_CLOCK_WORDS_CACHE
+			  store_clock_words(pblock_addr[reconfigurable_regions - 1], y, x0, xf);
+#endif
 			}
 		}
 	} else {
@@ -908,11 +1128,17 @@ int write_subclock_region_PBS(XDcfg *InstancePtr, u32 *addr_start, const char *f
 	if (reconfigurable_regions >= MAX_RECONFIGURABLE_CLOCK_REGIONS) {
 		return XST_FAILURE;
 	}
-	new_PBS_first_addr = previous_PBS_last_addr;
-	//Now we copy the new PBS above the address of the previous PBS
-	new_PBS_last_addr = (u32*) load_bitstream_from_SD_to_RAM(file_name, previous_PBS_last_addr);
-	if (new_PBS_last_addr == 0) {
-		return XST_FAILURE;
+	if (file_name != NULL) {
+		new_PBS_first_addr = previous_PBS_last_addr;
+		//Now we copy the new PBS above the address of the previous PBS
+		new_PBS_last_addr = (u32*) load_bitstream_from_SD_to_RAM(file_name, previous_PBS_last_addr);
+		if (new_PBS_last_addr == 0) {
+			return XST_FAILURE;
+		}
+	} else {
+		//The new PBS is already in RAM, we combine it directly from there
+		new_PBS_first_addr = PBS_addr;
+		new_PBS_last_addr = (u32*) PBS_last_addr;
 	}
 
 	// XTime_GetTime(&transfer); // Get time count
@@ -928,7 +1154,7 @@ int write_subclock_region_PBS(XDcfg *InstancePtr, u32 *addr_start, const char *f
 	* be helpful to control the vertical clock lines enabling and disabling them on run-time
 	*/
 
-	words_per_half_clock_region_without_clock = (NUM_FRAME_WORDS - CLOCK_WORDS) / 2;
+	words_per_half_clock_region_without_clock = (FRAME_WORDS - FRAME_CLOCK_WORDS) / 2;
 
 	for (i = 0; i < num_pblocks; i++) {
 		x0 = pblock_list[i].X0;
@@ -936,19 +1162,19 @@ int write_subclock_region_PBS(XDcfg *InstancePtr, u32 *addr_start, const char *f
 		xf = pblock_list[i].Xf;
 		yf = pblock_list[i].Yf;
 
-		initial_clock_region_row = (int) y0 / (int) ROWS_PER_CLOCK_REGION;
-		final_clock_region_row = (int) yf / (int) ROWS_PER_CLOCK_REGION;
+		initial_clock_region_row = (int) y0 / (int) CLOCK_REGION_ROWS;
+		final_clock_region_row = (int) yf / (int) CLOCK_REGION_ROWS;
 
 		for(y = initial_clock_region_row; y <= final_clock_region_row; y++) {
 		  first_words_not_used = 0;
 		  last_words_not_used = 0;
 		  if(y == initial_clock_region_row) {
-			first_rows_not_used = y0 - (initial_clock_region_row * ROWS_PER_CLOCK_REGION);
-			first_words_not_used = first_rows_not_used * WORDS_PER_ROW_IN_CLOCK_REGION;
+			first_rows_not_used = y0 - (initial_clock_region_row * CLOCK_REGION_ROWS);
+			first_words_not_used = ROWS_TO_WORDS(first_rows_not_used);
 		  }
 		  if(y == final_clock_region_row) {
-			last_rows_not_used = (((final_clock_region_row + 1) * ROWS_PER_CLOCK_REGION) - 1) - yf;
-			last_words_not_used = last_rows_not_used * WORDS_PER_ROW_IN_CLOCK_REGION;
+			last_rows_not_used = (((final_clock_region_row + 1) * CLOCK_REGION_ROWS) - 1) - yf;
+			last_words_not_used = ROWS_TO_WORDS(last_rows_not_used);
 		  }
 		  /**
 		  * We move the contents of the new PBS (located in the upper part of the RAM) to the lower part
@@ -961,27 +1187,27 @@ int write_subclock_region_PBS(XDcfg *InstancePtr, u32 *addr_start, const char *f
 //			  last_half_first_unused_bytes = 0;
 			  last_half_bytes_to_move = (words_per_half_clock_region_without_clock - last_words_not_used) * BYTES_PER_WORD_OF_FRAME;
 			  for(x = x0; x <= xf; x++) {
-				  num_frames = fpga[y][x][0] & 0xFFFF;
+				  num_frames = DEVICE_FRAMES(y, x);
 				  extra_frames = 0;
-				  if (fpga[y][x][1] == CLK_TYPE) {
-					  extra_frames = num_frames - FRAMES_CLK_INTERCONNECT;
-					  num_frames = FRAMES_CLK_INTERCONNECT;
-				  } else if (fpga[y][x][1] == CFG_TYPE) {
-            extra_frames = num_frames - FRAMES_CLK_INTERCONNECT;
-					  num_frames = FRAMES_CLK_INTERCONNECT;
+				  if (DEVICE_TYPE(y, x) == CLK_TYPE) {
+					  extra_frames = num_frames - CLK_INTERCONNECT_FRAMES;
+					  num_frames = CLK_INTERCONNECT_FRAMES;
+				  } else if (DEVICE_TYPE(y, x) == CFG_TYPE) {
+            extra_frames = num_frames - CLK_INTERCONNECT_FRAMES;
+					  num_frames = CLK_INTERCONNECT_FRAMES;
 				  }
 				  for(frame = 0; frame < num_frames; frame++) {
-					  memmove((u32*) ((u32) previous_PBS_first_addr + first_half_first_unused_bytes), new_PBS_first_addr, first_half_bytes_to_move);
-					  new_PBS_first_addr = (u32*) ((u32) new_PBS_first_addr + first_half_bytes_to_move);
-					  previous_PBS_first_addr = (u32*) ((u32) previous_PBS_first_addr + (words_per_half_clock_region_without_clock + CLOCK_WORDS) * BYTES_PER_WORD_OF_FRAME);
-					  memmove((u32*) ((u32) previous_PBS_first_addr), new_PBS_first_addr, last_half_bytes_to_move);
-					  new_PBS_first_addr = (u32*) ((u32) new_PBS_first_addr + last_half_bytes_to_move);
-					  previous_PBS_first_addr = (u32*) ((u32) previous_PBS_first_addr + words_per_half_clock_region_without_clock * BYTES_PER_WORD_OF_FRAME);
+					  memmove((u32*) ((UINTPTR) previous_PBS_first_addr + first_half_first_unused_bytes), new_PBS_first_addr, first_half_bytes_to_move);
+					  new_PBS_first_addr = (u32*) ((UINTPTR) new_PBS_first_addr + first_half_bytes_to_move);
+					  previous_PBS_first_addr = (u32*) ((UINTPTR) previous_PBS_first_addr + (words_per_half_clock_region_without_clock + FRAME_CLOCK_WORDS) * BYTES_PER_WORD_OF_FRAME);
+					  memmove((u32*) ((UINTPTR) previous_PBS_first_addr), new_PBS_first_addr, last_half_bytes_to_move);
+					  new_PBS_first_addr = (u32*) ((UINTPTR) new_PBS_first_addr + last_half_bytes_to_move);
+					  previous_PBS_first_addr = (u32*) ((UINTPTR) previous_PBS_first_addr + words_per_half_clock_region_without_clock * BYTES_PER_WORD_OF_FRAME);
 
 				  }
 				  for (frame = 0; frame < extra_frames; frame++) {
-					  new_PBS_first_addr =  (u32*) ((u32) new_PBS_first_addr + first_half_bytes_to_move + last_half_bytes_to_move);
-					  previous_PBS_first_addr = (u32*) ((u32) previous_PBS_first_addr + NUM_FRAME_BYTES);
+					  new_PBS_first_addr =  (u32*) ((UINTPTR) new_PBS_first_addr + first_half_bytes_to_move + last_half_bytes_to_move);
+					  previous_PBS_first_addr = (u32*) ((UINTPTR) previous_PBS_first_addr + FRAME_BYTES);
 				  }
 			  }
 
@@ -992,24 +1218,24 @@ int write_subclock_region_PBS(XDcfg *InstancePtr, u32 *addr_start, const char *f
 			  last_half_first_unused_bytes = (first_words_not_used - words_per_half_clock_region_without_clock) * BYTES_PER_WORD_OF_FRAME;
 			  last_half_bytes_to_move = ((words_per_half_clock_region_without_clock - last_words_not_used) * BYTES_PER_WORD_OF_FRAME) - last_half_first_unused_bytes;
 			  for(x = x0; x <= xf; x++) {
-				  num_frames = fpga[y][x][0] & 0xFFFF;
+				  num_frames = DEVICE_FRAMES(y, x);
 				  extra_frames = 0;
-				  if (fpga[y][x][1] == CLK_TYPE) {
-					  extra_frames = num_frames - FRAMES_CLK_INTERCONNECT;
-					  num_frames = FRAMES_CLK_INTERCONNECT;
-				  } else if (fpga[y][x][1] == CFG_TYPE) {
-            extra_frames = num_frames - FRAMES_CLK_INTERCONNECT;
-					  num_frames = FRAMES_CLK_INTERCONNECT;
+				  if (DEVICE_TYPE(y, x) == CLK_TYPE) {
+					  extra_frames = num_frames - CLK_INTERCONNECT_FRAMES;
+					  num_frames = CLK_INTERCONNECT_FRAMES;
+				  } else if (DEVICE_TYPE(y, x) == CFG_TYPE) {
+            extra_frames = num_frames - CLK_INTERCONNECT_FRAMES;
+					  num_frames = CLK_INTERCONNECT_FRAMES;
 				  }
 				  for(frame = 0; frame < num_frames; frame++) {
-					  previous_PBS_first_addr = (u32*) ((u32) previous_PBS_first_addr + (words_per_half_clock_region_without_clock + CLOCK_WORDS) * BYTES_PER_WORD_OF_FRAME);
-					  memmove((u32*) ((u32) previous_PBS_first_addr + last_half_first_unused_bytes), new_PBS_first_addr, last_half_bytes_to_move);
-					  new_PBS_first_addr = (u32*) ((u32) new_PBS_first_addr + last_half_bytes_to_move);
-					  previous_PBS_first_addr = (u32*) ((u32) previous_PBS_first_addr + words_per_half_clock_region_without_clock * BYTES_PER_WORD_OF_FRAME);
+					  previous_PBS_first_addr = (u32*) ((UINTPTR) previous_PBS_first_addr + (words_per_half_clock_region_without_clock + FRAME_CLOCK_WORDS) * BYTES_PER_WORD_OF_FRAME);
+					  memmove((u32*) ((UINTPTR) previous_PBS_first_addr + last_half_first_unused_bytes), new_PBS_first_addr, last_half_bytes_to_move);
+					  new_PBS_first_addr = (u32*) ((UINTPTR) new_PBS_first_addr + last_half_bytes_to_move);
+					  previous_PBS_first_addr = (u32*) ((UINTPTR) previous_PBS_first_addr + words_per_half_clock_region_without_clock * BYTES_PER_WORD_OF_FRAME);
 				  }
 				  for (frame = 0; frame < extra_frames; frame++) {
-					  new_PBS_first_addr =  (u32*) ((u32) new_PBS_first_addr + last_half_bytes_to_move);
-					  previous_PBS_first_addr = (u32*) ((u32) previous_PBS_first_addr + NUM_FRAME_BYTES);
+					  new_PBS_first_addr =  (u32*) ((UINTPTR) new_PBS_first_addr + last_half_bytes_to_move);
+					  previous_PBS_first_addr = (u32*) ((UINTPTR) previous_PBS_first_addr + FRAME_BYTES);
 				  }
 			  }
 
@@ -1021,24 +1247,24 @@ int write_subclock_region_PBS(XDcfg *InstancePtr, u32 *addr_start, const char *f
 //			  last_half_first_unused_bytes = 0; //In this case we don't care about this value
 //			  last_half_bytes_to_move = 0;
 			  for(x = x0; x <= xf; x++) {
-				  num_frames = fpga[y][x][0] & 0xFFFF;
+				  num_frames = DEVICE_FRAMES(y, x);
 				  extra_frames = 0;
-				  if (fpga[y][x][1] == CLK_TYPE) {
-					  extra_frames = num_frames - FRAMES_CLK_INTERCONNECT;
-					  num_frames = FRAMES_CLK_INTERCONNECT;
-				  } else if (fpga[y][x][1] == CFG_TYPE) {
-					  extra_frames = num_frames - FRAMES_CLK_INTERCONNECT;
-				    num_frames = FRAMES_CLK_INTERCONNECT;
+				  if (DEVICE_TYPE(y, x) == CLK_TYPE) {
+					  extra_frames = num_frames - CLK_INTERCONNECT_FRAMES;
+					  num_frames = CLK_INTERCONNECT_FRAMES;
+				  } else if (DEVICE_TYPE(y, x) == CFG_TYPE) {
+					  extra_frames = num_frames - CLK_INTERCONNECT_FRAMES;
+				    num_frames = CLK_INTERCONNECT_FRAMES;
 				  }
 				  for(frame = 0; frame < num_frames; frame++) {
-					  memmove((u32*) ((u32) previous_PBS_first_addr + first_half_first_unused_bytes), new_PBS_first_addr, first_half_bytes_to_move);
-					  new_PBS_first_addr = (u32*) ((u32) new_PBS_first_addr + first_half_bytes_to_move);
-					  previous_PBS_first_addr = (u32*) ((u32) previous_PBS_first_addr + NUM_FRAME_BYTES);
+					  memmove((u32*) ((UINTPTR) previous_PBS_first_addr + first_half_first_unused_bytes), new_PBS_first_addr, first_half_bytes_to_move);
+					  new_PBS_first_addr = (u32*) ((UINTPTR) new_PBS_first_addr + first_half_bytes_to_move);
+					  previous_PBS_first_addr = (u32*) ((UINTPTR) previous_PBS_first_addr + FRAME_BYTES);
 
 				  }
 				  for (frame = 0; frame < extra_frames; frame++) {
-					  new_PBS_first_addr =  (u32*) ((u32) new_PBS_first_addr + first_half_bytes_to_move);
-					  previous_PBS_first_addr = (u32*) ((u32) previous_PBS_first_addr + NUM_FRAME_BYTES);
+					  new_PBS_first_addr =  (u32*) ((UINTPTR) new_PBS_first_addr + first_half_bytes_to_move);
+					  previous_PBS_first_addr = (u32*) ((UINTPTR) previous_PBS_first_addr + FRAME_BYTES);
 				  }
 			  }
 		  } else {
@@ -1046,14 +1272,14 @@ int write_subclock_region_PBS(XDcfg *InstancePtr, u32 *addr_start, const char *f
 			  return XST_FAILURE;
 		  }
 //		  for(x = x0; x <= xf; x++) {
-//			num_frames = fpga[y][x][0] & 0xFFFF;
+//			num_frames = DEVICE_FRAMES(y, x);
 //			for(frame = 0; frame < num_frames; frame++) {
-//				memmove((u32*) ((u32) previous_PBS_first_addr + first_half_first_unused_bytes), new_PBS_first_addr, first_half_bytes_to_move);
-//				new_PBS_first_addr = (u32*) ((u32) new_PBS_first_addr + first_half_bytes_to_move);
-//				previous_PBS_first_addr = (u32*) ((u32) previous_PBS_first_addr + (words_per_half_clock_region_without_clock + CLOCK_WORDS) * BYTES_PER_WORD_OF_FRAME);
-//				memmove((u32*) ((u32) previous_PBS_first_addr + last_half_first_unused_bytes), new_PBS_first_addr, last_half_bytes_to_move);
-//				new_PBS_first_addr = (u32*) ((u32) new_PBS_first_addr + last_half_bytes_to_move);
-//				previous_PBS_first_addr = (u32*) ((u32) previous_PBS_first_addr + words_per_half_clock_region_without_clock * BYTES_PER_WORD_OF_FRAME);
+//				memmove((u32*) ((UINTPTR) previous_PBS_first_addr + first_half_first_unused_bytes), new_PBS_first_addr, first_half_bytes_to_move);
+//				new_PBS_first_addr = (u32*) ((UINTPTR) new_PBS_first_addr + first_half_bytes_to_move);
+//				previous_PBS_first_addr = (u32*) ((UINTPTR) previous_PBS_first_addr + (words_per_half_clock_region_without_clock + FRAME_CLOCK_WORDS) * BYTES_PER_WORD_OF_FRAME);
+//				memmove((u32*) ((UINTPTR) previous_PBS_first_addr + last_half_first_unused_bytes), new_PBS_first_addr, last_half_bytes_to_move);
+//				new_PBS_first_addr = (u32*) ((UINTPTR) new_PBS_first_addr + last_half_bytes_to_move);
+//				previous_PBS_first_addr = (u32*) ((UINTPTR) previous_PBS_first_addr + words_per_half_clock_region_without_clock * BYTES_PER_WORD_OF_FRAME);
 //
 //			}
 //		}
@@ -1061,7 +1287,7 @@ int write_subclock_region_PBS(XDcfg *InstancePtr, u32 *addr_start, const char *f
 	}
 
 	//We check that the size of the region to reconfigure and the new PBS are compatible
-	if(( (u32) previous_PBS_first_addr != (u32) previous_PBS_last_addr ) || ((u32) new_PBS_first_addr != (u32) new_PBS_last_addr) ) {
+	if(( (UINTPTR) previous_PBS_first_addr != (UINTPTR) previous_PBS_last_addr ) || ((UINTPTR) new_PBS_first_addr != (UINTPTR) new_PBS_last_addr) ) {
 		return XST_FAILURE;
 	}
 
@@ -1078,11 +1304,11 @@ int write_subclock_region_PBS(XDcfg *InstancePtr, u32 *addr_start, const char *f
 			xf = pblock_list[i].Xf;
 			yf = pblock_list[i].Yf;
 
-			initial_clock_region_row = (int) y0 / (int) ROWS_PER_CLOCK_REGION;
-			final_clock_region_row = (int) yf / (int) ROWS_PER_CLOCK_REGION;
+			initial_clock_region_row = (int) y0 / (int) CLOCK_REGION_ROWS;
+			final_clock_region_row = (int) yf / (int) CLOCK_REGION_ROWS;
 
 			for(y = initial_clock_region_row; y <= final_clock_region_row; y++) {
-			  status = PCAP_RAM_write(InstancePtr, pblock_addr[reconfigurable_regions], (u32) (pblock_addr[reconfigurable_regions + 1]), x0, y, xf, y, erase_bram);
+			  status = PCAP_RAM_write(InstancePtr, pblock_addr[reconfigurable_regions], (UINTPTR) (pblock_addr[reconfigurable_regions + 1]), x0, y, xf, y, erase_bram);
 			  if (status != XST_SUCCESS) {
 				return XST_FAILURE;
 			  }
@@ -1098,3 +1324,120 @@ int write_subclock_region_PBS(XDcfg *InstancePtr, u32 *addr_start, const char *f
 
 	return XST_SUCCESS;
 }
+
+/****************************************************************************/
+/**
+*
+* Invalidates the clock words stored from previous readbacks. It has to be
+* called if the FPGA is reconfigured without using this library (e.g. when a
+* full bitstream is loaded).
+*
+* @return	none
+*
+*****************************************************************************/
+void PCAP_invalidate_clock_words_cache()
+{
+#ifdef PCAP_CLOCK_WORDS_CACHE
+	memset(clock_words_index, 0, sizeof(clock_words_index));
+	memset(clock_words_valid, 0, sizeof(clock_words_valid));
+	clock_words_cache_used = 0;
+#endif
+}
+
+/****************************************************************************/
+/**
+*
+* Invalidates the clock words stored for the column of a frame. The space of
+* the column in the cache is kept and it is filled again by the next readback.
+*
+* @param	frame_address - FAR of any frame of the column
+*
+* @return	none
+*
+*****************************************************************************/
+void PCAP_invalidate_clock_words_frame(u32 frame_address)
+{
+#ifdef PCAP_CLOCK_WORDS_CACHE
+	u32 y, row_base, column;
+
+	if (((frame_address >> DEVICE_FAMILY->far_block_shift) & PCAP_FAR_BLOCK_MASK) != PCAP_FAR_CLB_BLOCK) {
+		return;
+	}
+	// The fields between the column address and the block type select the clock region row
+	row_base = frame_address & ((1 << DEVICE_FAMILY->far_block_shift) - 1) & ~((DEVICE_FAR_COLUMN_MASK << DEVICE_FAMILY->far_column_shift) | ((1 << DEVICE_FAMILY->far_column_shift) - 1));
+	column = (frame_address >> DEVICE_FAMILY->far_column_shift) & DEVICE_FAR_COLUMN_MASK;
+	for (y = 0; y < fpga_device->rows; y++) {
+		if (DEVICE_FAR(y) == row_base && column < fpga_device->columns) {
+			clock_words_valid[y][column] = 0;
+			return;
+		}
+	}
+#endif
+}
+
+#ifdef PCAP_CLOCK_WORDS_CACHE
+/*
+ * Stores the clock words of every frame of the columns x0 to xf of a clock
+ * region row that has just been read back into addr_start. Columns that are
+ * already stored are skipped, the clock words are never modified by
+ * write_subclock_region_PBS. The fine-grain reconfiguration overwrites them,
+ * so it invalidates its columns (PCAP_invalidate_clock_words_frame) and they
+ * are stored again in the same place.
+ */
+static void store_clock_words(u32 *addr_start, u32 row, u32 x0, u32 xf)
+{
+	u32 x, frame, num_frames;
+	u32 *clock_word;
+
+	clock_word = addr_start + (FRAME_WORDS - FRAME_CLOCK_WORDS) / 2;
+	for (x = x0; x <= xf; x++) {
+		num_frames = DEVICE_FRAMES(row, x);
+		if (clock_words_index[row][x] == 0 && clock_words_cache_used + num_frames * FRAME_CLOCK_WORDS <= PCAP_CLOCK_WORDS_CACHE_SIZE) {
+			clock_words_index[row][x] = clock_words_cache_used + 1;
+			clock_words_cache_used += num_frames * FRAME_CLOCK_WORDS;
+		}
+		if (clock_words_index[row][x] != 0 && !clock_words_valid[row][x]) {
+			for (frame = 0; frame < num_frames; frame++) {
+				memcpy(&clock_words_cache[clock_words_index[row][x] - 1 + frame * FRAME_CLOCK_WORDS], &clock_word[frame * FRAME_WORDS], FRAME_CLOCK_WORDS * BYTES_PER_WORD_OF_FRAME);
+			}
+			clock_words_valid[row][x] = 1;
+		}
+		clock_word += num_frames * FRAME_WORDS;
+	}
+}
+
+/*
+ * Writes the stored clock words of the columns x0 to xf of a clock region row
+ * in the positions where PCAP_RAM_read would have placed them and advances
+ * addr_start as PCAP_RAM_read does. The rest of the words are not initialized.
+ * CLK and CFG columns keep frames that are not in the PBS, so they always
+ * need a readback.
+ *
+ * Returns XST_FAILURE if the clock words of any column are not stored or they
+ * have been invalidated.
+ */
+static int load_clock_words(u32 **addr_start, u32 row, u32 x0, u32 xf)
+{
+	u32 x, frame, num_frames;
+	u32 *clock_word, *cached_word;
+
+	for (x = x0; x <= xf; x++) {
+		if (!clock_words_valid[row][x] || DEVICE_TYPE(row, x) == CLK_TYPE || DEVICE_TYPE(row, x) == CFG_TYPE) {
+			return XST_FAILURE;
+		}
+	}
+
+	clock_word = *addr_start + (FRAME_WORDS - FRAME_CLOCK_WORDS) / 2;
+	for (x = x0; x <= xf; x++) {
+		num_frames = DEVICE_FRAMES(row, x);
+		cached_word = &clock_words_cache[clock_words_index[row][x] - 1];
+		for (frame = 0; frame < num_frames; frame++) {
+			memcpy(&clock_word[frame * FRAME_WORDS], &cached_word[frame * FRAME_CLOCK_WORDS], FRAME_CLOCK_WORDS * BYTES_PER_WORD_OF_FRAME);
+		}
+		clock_word += num_frames * FRAME_WORDS;
+		*addr_start += num_frames * FRAME_WORDS;
+	}
+
+	return XST_SUCCESS;
+}
+#endif
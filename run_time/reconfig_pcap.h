@@ -9,8 +9,12 @@
 #define RECONFIG_PCAP_H_
 
 /***************************** Include Files ********************************/
+#ifdef PCAP_LINUX
+#include "reconfig_pcap_linux.h"
+#else
 #include "xil_types.h"
 #include "xdevcfg.h"
+#endif
 
 
 /**************************** Constant Definitions *******************************/
@@ -27,6 +31,7 @@
 #define PCAP_XC7Z020                0x03727093
 #define PCAP_XC7Z030                0x0372C093
 #define PCAP_XC7Z045                0x03731093
+#define PCAP_XC7Z100                0x03736093
 
 // Configuration Type1/Type2 packets header masks
 #define PCAP_TYPE_MASK              0x7
@@ -75,7 +80,7 @@
 #define PCAP_FAR_MAJOR_FRAME_MASK   0xFF
 #define PCAP_FAR_ROW_ADDR_MASK      0x1F
 #define PCAP_FAR_MINOR_FRAME_MASK   0xFF
-#define PCAP_FAR_COLUMN_ADDR_MASK   0xFF
+#define PCAP_FAR_COLUMN_ADDR_MASK   0x3FF
 #define PCAP_FAR_MINOR_ADDR_MASK    0x7F
 #define PCAP_FAR_BLOCK_SHIFT        23//21
 #define PCAP_FAR_TOP_BOTTOM_SHIFT   22//20
@@ -162,9 +167,13 @@
 // Mask for the Device ID read from the ID code Register
 #define PCAP_DEVICE_ID_CODE_MASK    0x0FFFFFFF
 
+// Pblocks that can be written in one call to write_subclock_region_PBS
+#define PCAP_MAX_PBLOCKS            2
+
 //When we save a PBS it is divided as reconfigurable sections. One for each pblock, and for each
-//pblock one for each used clock region
-#define MAX_RECONFIGURABLE_CLOCK_REGIONS 15
+//pblock one for each used clock region. Every pblock can span all the clock region rows of the
+//biggest device, and one more entry holds the end address of the last section
+#define MAX_RECONFIGURABLE_CLOCK_REGIONS (PCAP_MAX_PBLOCKS * MAX_ROWS + 1)
 
 //Struct definition 
 typedef struct {
@@ -268,6 +277,28 @@ typedef struct {
 	((ColumnAddress) << PCAP_FAR_COLUMN_ADDR_SHIFT) | \
 	((MinorAddress) << PCAP_FAR_MINOR_ADDR_SHIFT))
 
+/****************************************************************************/
+/**
+*
+* Generates the FAR of a frame using the FAR of the first frame of the clock
+* region row pre-encoded in the device description (DEVICE_FAR) and the
+* position of the fields in the FAR of the device family.
+*
+* @param	Block - Address Block Type (CLB or BRAM address space)
+* @param	Row - Clock region row of the device template
+* @param	ColumnAddress - CLB or BRAM column
+* @param	MinorAddress - Frame within a column
+*
+* @return	Value of the FAR
+*
+* @note		None.
+*
+*****************************************************************************/
+#define PCAP_SetupFarRow(Block, Row, ColumnAddress, MinorAddress)  \
+	(DEVICE_FAR(Row) | ((Block) << DEVICE_FAMILY->far_block_shift) | \
+	((ColumnAddress) << DEVICE_FAMILY->far_column_shift) | \
+	((MinorAddress) << PCAP_FAR_MINOR_ADDR_SHIFT))
+
 
 /************************** Function Prototypes ******************************/
 
@@ -282,7 +313,23 @@ typedef struct {
 * @return final position of the PBS in the RAM
 *
 *****************************************************************************/
-u32 load_bitstream_from_SD_to_RAM(const char *file_name, u32 *addr_start);
+UINTPTR load_bitstream_from_SD_to_RAM(const char *file_name, u32 *addr_start);
+
+/****************************************************************************/
+/**
+*
+* Loads a partial bitstream file from the external SD card to the on-board RAM
+* checking that it fits in the memory region reserved for it
+*
+* @param file_name is the name of the PBS file stored in the SD card
+* @param addr_start is the initial position of the PBS in the RAM
+* @param max_bytes is the size of the RAM region that can store the PBS
+*
+* @return final position of the PBS in the RAM or 0 if the PBS could not be
+*         loaded
+*
+*****************************************************************************/
+UINTPTR load_bitstream_from_SD_to_RAM_bounded(const char *file_name, u32 *addr_start, u32 max_bytes);
 
 /****************************************************************************/
 /**
@@ -310,6 +357,25 @@ u32 load_bitstream_from_RAM_to_SD(const char *file_name, u32 *addr_start, u32 To
 *****************************************************************************/
 int PCAP_Initialize(XDcfg *InstancePtr, u16 DeviceId);
 
+/****************************************************************************/
+/**
+*
+* Transfers data through the PCAP and waits until it finishes. This is the only
+* function that accesses the configuration port, it is implemented for
+* bare-metal in reconfig_pcap.c and for Linux in reconfig_pcap_linux.c
+*
+* @param InstancePtr is a pointer to the PCAP instance.
+* @param source is the data to write in the PCAP (NULL if nothing is written)
+* @param source_words is the number of words to write
+* @param destination is where the data read from the PCAP is stored (NULL if
+*        nothing is read)
+* @param destination_words is the number of words to read
+*
+* @return	XST_SUCCESS else XST_FAILURE.
+*
+*****************************************************************************/
+int PCAP_Transfer(XDcfg *InstancePtr, u32 *source, u32 source_words, u32 *destination, u32 destination_words);
+
 /****************************************************************************/
 /**
 *
@@ -324,7 +390,24 @@ int PCAP_Initialize(XDcfg *InstancePtr, u16 DeviceId);
 * @return	XST_SUCCESS else XST_FAILURE.
 *
 *****************************************************************************/
-int PCAP_RAM_write(XDcfg *InstancePtr, u32 *addr_start, u32 addr_end, u32 x0, u32 y0, u32 xf, u32 yf, u32 erase_bram);
+int PCAP_RAM_write(XDcfg *InstancePtr, u32 *addr_start, UINTPTR addr_end, u32 x0, u32 y0, u32 xf, u32 yf, u32 erase_bram);
+
+/****************************************************************************/
+/**
+*
+* Writes runs of consecutive frames using PCAP interface
+*
+* @param InstancePtr is a pointer to the PCAP instance.
+* @param frame_address is the FAR of the first frame of each run
+* @param num_frames is the number of frames of each run
+* @param num_runs is the number of runs
+* @param frames is a pointer to the frames of all the runs. Each run is
+*        followed by a padding frame
+*
+* @return	XST_SUCCESS else XST_FAILURE.
+*
+*****************************************************************************/
+int PCAP_write_frames(XDcfg *InstancePtr, u32 *frame_address, u32 *num_frames, u32 num_runs, u32 *frames);
 
 /****************************************************************************/
 /**
@@ -341,6 +424,77 @@ int PCAP_RAM_write(XDcfg *InstancePtr, u32 *addr_start, u32 addr_end, u32 x0, u3
 *****************************************************************************/
 int PCAP_RAM_read(XDcfg *InstancePtr, u32 **addr_start, u32 x0, u32 y0, u32 xf, u32 yf);
 
+/****************************************************************************/
+/**
+*
+* Reads the IDCODE register of the device through the PCAP
+*
+* @param InstancePtr is a pointer to the PCAP instance.
+* @param idcode is where the IDCODE is stored
+*
+* @return   XST_SUCCESS else XST_FAILURE.
+*
+*****************************************************************************/
+int PCAP_read_IDCODE(XDcfg *InstancePtr, u32 *idcode);
+
+/****************************************************************************/
+/**
+*
+* Obtains the RAM used from addr_start by write_subclock_region_PBS to read
+* back a region before the new PBS is placed after it
+*
+* @param pblock_list[] array with the pblocks of the region
+* @param num_pblocks total number of pblocks in the array.
+*
+* @return	bytes used by the readback
+*
+*****************************************************************************/
+u32 PCAP_staging_bytes(pblock pblock_list[], u32 num_pblocks);
+
 int write_subclock_region_PBS(XDcfg *InstancePtr, u32 *addr_start, const char *file_name, pblock pblock_list[], u32 num_pblocks, u32 erase_bram, u8 stacked_modules);
 
+/****************************************************************************/
+/**
+*
+* Equivalent to write_subclock_region_PBS but the PBS has already been loaded
+* in RAM. The PBS is left untouched so it can be reused later.
+*
+* @param InstancePtr is a pointer to the PCAP instance.
+* @param addr_start is a pointer to free memory used to read back the region
+* @param PBS_addr is the first RAM position of the PBS
+* @param PBS_last_addr is the last RAM position of the PBS
+* @param pblock_list, num_pblocks, erase_bram, stacked_modules: see
+*        write_subclock_region_PBS
+*
+* @return	XST_SUCCESS else XST_FAILURE.
+*
+*****************************************************************************/
+int write_subclock_region_PBS_from_RAM(XDcfg *InstancePtr, u32 *addr_start, u32 *PBS_addr, UINTPTR PBS_last_addr, pblock pblock_list[], u32 num_pblocks, u32 erase_bram, u8 stacked_modules);
+
+/****************************************************************************/
+/**
+*
+* Invalidates the clock words stored from previous readbacks. It has to be
+* called if the FPGA is reconfigured without using this library (e.g. when a
+* full bitstream is loaded).
+*
+* @return	none
+*
+*****************************************************************************/
+void PCAP_invalidate_clock_words_cache();
+
+/****************************************************************************/
+/**
+*
+* Invalidates the clock words stored for the column of a frame. It has to be
+* called when the frame is written without using this library, e.g. by the
+* fine-grain reconfiguration engine, which overwrites the clock word.
+*
+* @param	frame_address - FAR of any frame of the column
+*
+* @return	none
+*
+*****************************************************************************/
+void PCAP_invalidate_clock_words_frame(u32 frame_address);
+
 #endif /* RECONFIG_PCAP_H_ */
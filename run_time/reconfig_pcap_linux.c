@@ -0,0 +1,447 @@
+/*
+ * reconfig_pcap_linux.c
+ *
+ * Linux userspace backend of reconfig_pcap.c (compile with -DPCAP_LINUX).
+ * The configuration stream generated by PCAP_RAM_write and PCAP_RAM_read is
+ * written to the devcfg character device. If the configuration device is a
+ * regular file, it is used as a stand-in of the configuration memory: the
+ * packets are decoded and the frames are written to (or read from) the file.
+ */
+
+#ifdef PCAP_LINUX
+
+/***************************** Include Files ********************************/
+#include "reconfig_pcap.h"
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// FPGA description file
+#include "device.h"
+#include "series7.h"
+
+
+/************************** Function Prototypes *****************************/
+static u32 swap_bytes(u32 word);
+static int config_memory_write(XDcfg *InstancePtr, u32 *source, u32 source_words);
+static int config_memory_read(XDcfg *InstancePtr, u32 *destination, u32 destination_words);
+static void config_memory_write_register(XDcfg *InstancePtr, u32 data);
+static void config_memory_frame(XDcfg *InstancePtr);
+static int config_memory_frame_index(u32 far);
+
+
+/************************** Variable Definitions ****************************/
+static u32 frame_offset[MAX_ROWS][MAX_COLUMNS]; // Position of the first frame of each column in the configuration memory stand-in
+
+
+/************************** Function Definitions ****************************/
+
+UINTPTR load_bitstream_from_SD_to_RAM_bounded(const char *file_name, u32 *addr_start, u32 max_bytes)
+{
+    int fd;
+    struct stat file_stat;
+    u32 *file_data;
+    u32 i, words;
+
+    fd = open(file_name, O_RDONLY);
+    if (fd < 0)
+    {
+        xil_printf("ERROR: File %s not opened\n", file_name);
+        return 0;
+    }
+    if (fstat(fd, &file_stat) < 0 || file_stat.st_size > max_bytes)
+    {
+        xil_printf("ERROR: File %s does not fit in %d bytes\n", file_name, max_bytes);
+        close(fd);
+        return 0;
+    }
+
+    // The file is mapped so that it is read only once, while the byte order is
+    // corrected in the copy to the staging memory
+    words = file_stat.st_size / sizeof(u32);
+    if (words > 0)
+    {
+        file_data = mmap(NULL, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (file_data == MAP_FAILED)
+        {
+            close(fd);
+            return 0;
+        }
+        for (i = 0; i < words; i++)
+        {
+            addr_start[i] = swap_bytes(file_data[i]);
+        }
+        munmap(file_data, file_stat.st_size);
+    }
+    close(fd);
+
+    return (UINTPTR) addr_start + words * sizeof(u32);
+}
+
+u32 load_bitstream_from_RAM_to_SD(const char *file_name, u32 *addr_start, u32 TotalWords)
+{
+    FILE *file;
+    u32 i, aux;
+
+    file = fopen(file_name, "wb");
+    if (file == NULL)
+    {
+        xil_printf("ERROR: File %s not opened\n", file_name);
+        return 0;
+    }
+    for (i = 0; i < TotalWords; i++)
+    {
+        aux = swap_bytes(addr_start[i]);
+        if (fwrite(&aux, sizeof(u32), 1, file) != 1)
+        {
+            xil_printf("ERROR: data %s not written\n", file_name);
+            fclose(file);
+            return 0;
+        }
+    }
+    fclose(file);
+
+    return 1;
+}
+
+int PCAP_Initialize(XDcfg *InstancePtr, u16 DeviceId)
+{
+    const char *device;
+
+    (void) DeviceId;
+    device = getenv(PCAP_LINUX_DEVICE_ENV);
+    if (device == NULL)
+    {
+        device = PCAP_LINUX_DEVICE;
+    }
+
+    return PCAP_Initialize_device(InstancePtr, device);
+}
+
+int PCAP_Initialize_device(XDcfg *InstancePtr, const char *device)
+{
+    struct stat device_stat;
+    const char *idcode;
+    u32 x, y, frames;
+    int fd;
+
+    memset(InstancePtr, 0, sizeof(XDcfg));
+    InstancePtr->config_memory = NULL;
+
+    InstancePtr->fd = open(device, O_RDWR | O_CREAT, 0644);
+    if (InstancePtr->fd < 0 || fstat(InstancePtr->fd, &device_stat) < 0)
+    {
+        xil_printf("ERROR: Configuration device %s not opened\n", device);
+        return XST_FAILURE;
+    }
+
+    if (S_ISREG(device_stat.st_mode))
+    {
+        // The stand-in models the device with the IDCODE of the environment
+        // variable PCAP_LINUX_IDCODE_ENV (the first supported device if unset)
+        idcode = getenv(PCAP_LINUX_IDCODE_ENV);
+        if (idcode != NULL && device_select(strtoul(idcode, NULL, 0)) != XST_SUCCESS)
+        {
+            xil_printf("ERROR: Device %s not supported\n", idcode);
+            return XST_FAILURE;
+        }
+
+        // Frames are stored following the order of the device description
+        frames = 0;
+        for (y = 0; y < fpga_device->rows; y++)
+        {
+            for (x = 0; x < fpga_device->columns; x++)
+            {
+                frame_offset[y][x] = frames;
+                frames += DEVICE_FRAMES(y, x);
+            }
+        }
+        if (device_stat.st_size < frames * FRAME_BYTES && ftruncate(InstancePtr->fd, frames * FRAME_BYTES) < 0)
+        {
+            return XST_FAILURE;
+        }
+        InstancePtr->config_memory = mmap(NULL, frames * FRAME_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, InstancePtr->fd, 0);
+        if (InstancePtr->config_memory == MAP_FAILED)
+        {
+            InstancePtr->config_memory = NULL;
+            return XST_FAILURE;
+        }
+        InstancePtr->config_memory_frames = frames;
+    }
+    else
+    {
+        // The devcfg driver has to know that the device is not reset
+        fd = open(PCAP_LINUX_PARTIAL_FLAG, O_WRONLY);
+        if (fd >= 0)
+        {
+            if (write(fd, "1", 1) != 1)
+            {
+                close(fd);
+                return XST_FAILURE;
+            }
+            close(fd);
+        }
+    }
+
+    InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
+
+    return XST_SUCCESS;
+}
+
+u32 *PCAP_alloc_staging_memory(u32 bytes)
+{
+    u32 *memory;
+    int fd;
+
+    fd = open(PCAP_LINUX_UDMABUF, O_RDWR | O_SYNC);
+    if (fd >= 0)
+    {
+        memory = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (memory != MAP_FAILED)
+        {
+            return memory;
+        }
+    }
+
+    memory = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+    if (memory == MAP_FAILED)
+    {
+        return NULL;
+    }
+    mlock(memory, bytes);
+
+    return memory;
+}
+
+int PCAP_Transfer(XDcfg *InstancePtr, u32 *source, u32 source_words, u32 *destination, u32 destination_words)
+{
+    ssize_t bytes;
+    u32 done;
+
+    if (InstancePtr->config_memory != NULL)
+    {
+        if (source != NULL)
+        {
+            return config_memory_write(InstancePtr, source, source_words);
+        }
+        return config_memory_read(InstancePtr, destination, destination_words);
+    }
+
+    done = 0;
+    if (source != NULL)
+    {
+        while (done < source_words * sizeof(u32))
+        {
+            bytes = write(InstancePtr->fd, (u8 *) source + done, source_words * sizeof(u32) - done);
+            if (bytes <= 0)
+            {
+                return XST_FAILURE;
+            }
+            done += bytes;
+        }
+    }
+    else
+    {
+        while (done < destination_words * sizeof(u32))
+        {
+            bytes = read(InstancePtr->fd, (u8 *) destination + done, destination_words * sizeof(u32) - done);
+            if (bytes <= 0)
+            {
+                return XST_FAILURE;
+            }
+            done += bytes;
+        }
+    }
+
+    return XST_SUCCESS;
+}
+
+static u32 swap_bytes(u32 word)
+{
+    return ((word & 0xFF) << 24) + ((word & 0xFF00) << 8) + ((word & 0xFF0000) >> 8) + ((word & 0xFF000000) >> 24);
+}
+
+/*
+ * Decodes the configuration packets written to the stand-in. Only the
+ * registers used by reconfig_pcap.c are modelled: FAR, FDRI, FDRO, IDCODE
+ * and the DESYNC command.
+ */
+static int config_memory_write(XDcfg *InstancePtr, u32 *source, u32 source_words)
+{
+    u32 i, word, type, op, count;
+
+    for (i = 0; i < source_words; i++)
+    {
+        word = source[i];
+        if (!InstancePtr->synchronized)
+        {
+            InstancePtr->synchronized = (word == PCAP_SYNC_PACKET);
+            continue;
+        }
+        if (InstancePtr->packet_words > 0)
+        {
+            InstancePtr->packet_words--;
+            config_memory_write_register(InstancePtr, word);
+            continue;
+        }
+
+        type = (word >> PCAP_TYPE_SHIFT) & PCAP_TYPE_MASK;
+        op = (word >> PCAP_OP_SHIFT) & PCAP_OP_MASK;
+        if (type == PCAP_TYPE_1)
+        {
+            InstancePtr->reg = (word >> PCAP_REGISTER_SHIFT) & PCAP_REGISTER_MASK;
+            count = word & PCAP_WORD_COUNT_MASK_TYPE_1;
+        }
+        else if (type == PCAP_TYPE_2)
+        {
+            count = word & PCAP_WORD_COUNT_MASK_TYPE_2;
+        }
+        else
+        {
+            continue;
+        }
+
+        if (op == PCAP_OP_WRITE)
+        {
+            InstancePtr->packet_words = count;
+            if (InstancePtr->reg == PCAP_FDRI)
+            {
+                InstancePtr->frame_words = 0;
+                InstancePtr->frame_pending = 0;
+            }
+        }
+        else if (op == PCAP_OP_READ && InstancePtr->reg == PCAP_FDRO)
+        {
+            InstancePtr->read_words = count;
+            InstancePtr->idcode_read = 0;
+        }
+        else if (op == PCAP_OP_READ && InstancePtr->reg == PCAP_IDCODE)
+        {
+            InstancePtr->idcode_read = 1;
+        }
+    }
+
+    return XST_SUCCESS;
+}
+
+static void config_memory_write_register(XDcfg *InstancePtr, u32 data)
+{
+    switch (InstancePtr->reg)
+    {
+        case PCAP_FAR:
+            InstancePtr->far = data;
+            InstancePtr->frame_index = config_memory_frame_index(data);
+            break;
+        case PCAP_FDRI:
+            InstancePtr->frame[InstancePtr->frame_words++] = data;
+            if (InstancePtr->frame_words == FRAME_WORDS)
+            {
+                config_memory_frame(InstancePtr);
+            }
+            break;
+        case PCAP_CMD:
+            if (data == PCAP_CMD_DESYNCH)
+            {
+                InstancePtr->synchronized = 0;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/*
+ * As in the device, a frame received through FDRI is only written when the
+ * next one arrives, so the last (padding) frame of each write is discarded.
+ * Frames of other blocks (BRAM contents) are not modelled.
+ */
+static void config_memory_frame(XDcfg *InstancePtr)
+{
+    if (InstancePtr->frame_pending && InstancePtr->frame_index >= 0)
+    {
+        if (InstancePtr->frame_index < InstancePtr->config_memory_frames)
+        {
+            memcpy(&InstancePtr->config_memory[InstancePtr->frame_index * FRAME_WORDS], InstancePtr->frame_pending_data, FRAME_BYTES);
+        }
+        InstancePtr->frame_index++;
+    }
+    memcpy(InstancePtr->frame_pending_data, InstancePtr->frame, FRAME_BYTES);
+    InstancePtr->frame_pending = 1;
+    InstancePtr->frame_words = 0;
+}
+
+/*
+ * The device returns a dummy frame before the frames requested
+ */
+static int config_memory_read(XDcfg *InstancePtr, u32 *destination, u32 destination_words)
+{
+    int index;
+
+    if (InstancePtr->idcode_read)
+    {
+        if (destination_words != 1)
+        {
+            return XST_FAILURE;
+        }
+        destination[0] = fpga_device->idcode;
+        InstancePtr->idcode_read = 0;
+        return XST_SUCCESS;
+    }
+
+    if (destination_words > InstancePtr->read_words || destination_words < FRAME_WORDS)
+    {
+        return XST_FAILURE;
+    }
+    index = InstancePtr->frame_index;
+    if (index < 0 || index * FRAME_WORDS + destination_words - FRAME_WORDS > InstancePtr->config_memory_frames * FRAME_WORDS)
+    {
+        return XST_FAILURE;
+    }
+
+    memset(destination, 0, FRAME_BYTES);
+    memcpy(&destination[FRAME_WORDS], &InstancePtr->config_memory[index * FRAME_WORDS], (destination_words - FRAME_WORDS) * sizeof(u32));
+    InstancePtr->read_words = 0;
+
+    return XST_SUCCESS;
+}
+
+/*
+ * Obtains the position of a frame in the configuration memory stand-in from its
+ * frame address. Consecutive frames of a write or a read are stored in
+ * consecutive positions, as the FAR is incremented through the columns.
+ *
+ * Returns -1 if the frame is not in the CLB/IO/CLK block of the device.
+ */
+static int config_memory_frame_index(u32 far)
+{
+    u32 y, row_base, column, minor;
+
+    if (((far >> DEVICE_FAMILY->far_block_shift) & PCAP_FAR_BLOCK_MASK) != PCAP_FAR_CLB_BLOCK)
+    {
+        return -1;
+    }
+    // The fields between the column address and the block type select the clock region row
+    row_base = far & ((1 << DEVICE_FAMILY->far_block_shift) - 1) & ~((DEVICE_FAR_COLUMN_MASK << DEVICE_FAMILY->far_column_shift) | ((1 << DEVICE_FAMILY->far_column_shift) - 1));
+    column = (far >> DEVICE_FAMILY->far_column_shift) & DEVICE_FAR_COLUMN_MASK;
+    minor = far & ((1 << DEVICE_FAMILY->far_column_shift) - 1);
+
+    for (y = 0; y < fpga_device->rows; y++)
+    {
+        if (DEVICE_FAR(y) == row_base)
+        {
+            if (column >= fpga_device->columns)
+            {
+                return -1;
+            }
+            return frame_offset[y][column] + minor;
+        }
+    }
+
+    return -1;
+}
+
+#endif // #ifdef PCAP_LINUX
@@ -0,0 +1,100 @@
+/*
+ * reconfig_pcap_linux.h
+ *
+ * Definitions needed to build reconfig_pcap.c in Linux userspace (compile
+ * with -DPCAP_LINUX). They replace the types and the XDcfg driver instance of
+ * the Xilinx standalone BSP.
+ */
+
+#ifndef RECONFIG_PCAP_LINUX_H_
+#define RECONFIG_PCAP_LINUX_H_
+
+/***************************** Include Files ********************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <assert.h>
+
+
+/**************************** Constant Definitions *******************************/
+
+#define XST_SUCCESS                 0L
+#define XST_FAILURE                 1L
+#define XIL_COMPONENT_IS_READY      0x11111111U
+
+// Default configuration device. It can be changed with the environment variable
+// PCAP_LINUX_DEVICE_ENV. If it is a regular file it is used as a stand-in of
+// the configuration memory
+#define PCAP_LINUX_DEVICE           "/dev/xdevcfg"
+#define PCAP_LINUX_DEVICE_ENV       "IMPRESS_PCAP_DEVICE"
+#define PCAP_LINUX_IDCODE_ENV       "IMPRESS_PCAP_IDCODE" // Device modelled by the configuration memory stand-in
+#define PCAP_LINUX_PARTIAL_FLAG     "/sys/devices/soc0/amba/f8007000.devcfg/is_partial_bitstream"
+// Physically contiguous buffer used as staging memory if it is available
+#define PCAP_LINUX_UDMABUF          "/dev/udmabuf0"
+
+#define PCAP_LINUX_FRAME_WORDS      101 // Largest frame of the supported families
+
+
+/**************************** Type Definitions *******************************/
+
+typedef uint8_t   u8;
+typedef uint16_t  u16;
+typedef uint32_t  u32;
+typedef uint64_t  u64;
+typedef uintptr_t UINTPTR;
+
+typedef struct {
+	u32 IsReady;
+	int fd;                   // Configuration device or configuration memory file
+	// Configuration memory stand-in (only used when fd is a regular file)
+	u32 *config_memory;       // Frames of the CLB/IO/CLK block
+	u32 config_memory_frames;
+	u8 synchronized;          // A sync word has been received
+	u32 reg;                  // Register written by the last packet header
+	u32 packet_words;         // Words left in the current write packet
+	u32 far;                  // Frame address register
+	int frame_index;          // Position in config_memory of the frame addressed by FAR (-1 if not modelled)
+	u32 frame[PCAP_LINUX_FRAME_WORDS]; // Frame being received through FDRI
+	u32 frame_words;          // Words received of the current frame
+	u8 frame_pending;         // There is a complete frame waiting for the next one
+	u32 frame_pending_data[PCAP_LINUX_FRAME_WORDS];
+	u32 read_words;           // Words requested with the last FDRO read packet
+	u8 idcode_read;           // The last read packet requested the IDCODE register
+} XDcfg;
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define Xil_AssertNonvoid(Expression)  assert(Expression)
+#define xil_printf                     printf
+
+
+/************************** Function Prototypes *****************************/
+
+/****************************************************************************/
+/**
+*
+* Initializes a configuration device. If the device is a regular file it is
+* used as a stand-in of the configuration memory of the FPGA described in the
+* device template, which allows testing without hardware.
+*
+* @param InstancePtr is a pointer to the PCAP instance
+* @param device is the path of the configuration device or file
+*
+* @return	XST_SUCCESS else XST_FAILURE.
+*
+*****************************************************************************/
+int PCAP_Initialize_device(XDcfg *InstancePtr, const char *device);
+
+/****************************************************************************/
+/**
+*
+* Allocates the memory used to read back the regions and merge the PBS. The
+* memory is locked so that the pages are not moved while the PCAP uses them.
+*
+* @param bytes is the size of the memory
+*
+* @return	pointer to the memory or NULL if it could not be allocated
+*
+*****************************************************************************/
+u32 *PCAP_alloc_staging_memory(u32 bytes);
+
+#endif /* RECONFIG_PCAP_LINUX_H_ */
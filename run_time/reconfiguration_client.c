@@ -0,0 +1,87 @@
+/*
+ * reconfiguration_client.c
+ *
+ * Client side of the AMP reconfiguration server. It is executed on CPU0 and
+ * only accesses the rings shared with CPU1, so it does not need the PCAP, the
+ * SD card or the fine-grain reconfiguration engine.
+ */
+
+
+/***************************** Include Files ********************************/
+#include "reconfiguration_server.h"
+
+#if RECONFIGURATION_SERVER
+
+#include "xil_mmu.h"
+#include "xpseudo_asm.h"
+
+
+/************************** Constant Definitions ****************************/
+#define OCM_NON_CACHEABLE   0x14de2 // Shareable, non-cacheable translation table attributes
+
+
+/************************** Variable Definitions ****************************/
+static reconfiguration_server_shared_t *shared = (reconfiguration_server_shared_t *) RECONFIGURATION_SERVER_SHARED_ADDR;
+static u32 next_request_id;
+
+
+/************************** Function Definitions ****************************/
+
+void reconfiguration_client_init()
+{
+	Xil_SetTlbAttributes(RECONFIGURATION_SERVER_SHARED_ADDR, OCM_NON_CACHEABLE);
+
+	while (shared->ready != RECONFIGURATION_SERVER_READY);
+	dmb();
+	next_request_id = 0;
+}
+
+int reconfiguration_client_send(reconfiguration_request_t *request)
+{
+	u32 head;
+
+	head = shared->requests.head;
+	if (head - shared->requests.tail >= RECONFIGURATION_SERVER_RING_SIZE) {
+		return -1;
+	}
+
+	request->id = next_request_id++;
+	shared->requests.entries[head & (RECONFIGURATION_SERVER_RING_SIZE - 1)] = *request;
+	// The entry must be written before it is published
+	dmb();
+	shared->requests.head = head + 1;
+
+	return request->id;
+}
+
+int reconfiguration_client_get_completion(reconfiguration_completion_t *completion)
+{
+	u32 tail;
+
+	tail = shared->completions.tail;
+	if (shared->completions.head == tail) {
+		return 0;
+	}
+
+	dmb();
+	*completion = shared->completions.entries[tail & (RECONFIGURATION_SERVER_RING_SIZE - 1)];
+	dmb();
+	shared->completions.tail = tail + 1;
+
+	return 1;
+}
+
+void reconfiguration_client_get_statistics(reconfiguration_server_statistics_t *statistics)
+{
+	u32 sequence;
+
+	// Copy again if the server was updating the statistics
+	do {
+		sequence = shared->statistics_sequence;
+		dmb();
+		*statistics = shared->statistics;
+		dmb();
+	} while ((sequence & 1) != 0 || sequence != shared->statistics_sequence);
+}
+
+#endif
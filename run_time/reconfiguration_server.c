@@ -0,0 +1,137 @@
+/*
+ * reconfiguration_server.c
+ *
+ * Reconfiguration server executed on CPU1. It owns the virtual architecture
+ * and all the reconfiguration resources, so CPU0 is never blocked by the SD
+ * card, the PCAP or the fine-grain reconfiguration engine.
+ */
+
+
+/***************************** Include Files ********************************/
+#include "reconfiguration_server.h"
+
+#if RECONFIGURATION_SERVER
+
+#include "xstatus.h"
+#include "xtime_l.h"
+#include "xil_mmu.h"
+#include "xpseudo_asm.h"
+
+
+/************************** Constant Definitions ****************************/
+#define OCM_NON_CACHEABLE   0x14de2 // Shareable, non-cacheable translation table attributes
+
+
+/************************** Function Prototypes *****************************/
+static int execute_request(reconfiguration_request_t *request);
+
+
+/************************** Variable Definitions ****************************/
+static virtual_architecture_t virtual_architecture;
+
+
+/************************** Function Definitions ****************************/
+
+void reconfiguration_server_run()
+{
+	reconfiguration_server_shared_t *shared = (reconfiguration_server_shared_t *) RECONFIGURATION_SERVER_SHARED_ADDR;
+	reconfiguration_request_t *request;
+	reconfiguration_completion_t *completion;
+	u32 request_tail, completion_head;
+	XTime start, end;
+	int status;
+
+	Xil_SetTlbAttributes(RECONFIGURATION_SERVER_SHARED_ADDR, OCM_NON_CACHEABLE);
+
+	init_virtual_architecture();
+
+	shared->requests.head = 0;
+	shared->requests.tail = 0;
+	shared->completions.head = 0;
+	shared->completions.tail = 0;
+	shared->statistics.completed_requests = 0;
+	shared->statistics.failed_requests = 0;
+	shared->statistics.prefetched_PBS = 0;
+	shared->statistics.busy_cycles = 0;
+	shared->statistics_sequence = 0;
+	dmb();
+	shared->ready = RECONFIGURATION_SERVER_READY;
+
+	request_tail = 0;
+	completion_head = 0;
+	while (1) {
+		if (shared->requests.head == request_tail) {
+			#if PBS_PREFETCH
+			if (prefetch_partition_PBS(&virtual_architecture) == 1) {
+				shared->statistics_sequence++;
+				dmb();
+				shared->statistics.prefetched_PBS++;
+				dmb();
+				shared->statistics_sequence++;
+			}
+			#endif
+			continue;
+		}
+		// The entry can only be read once the producer has published it
+		dmb();
+		request = &shared->requests.entries[request_tail & (RECONFIGURATION_SERVER_RING_SIZE - 1)];
+
+		XTime_GetTime(&start);
+		status = execute_request(request);
+		XTime_GetTime(&end);
+
+		// Wait until the client reads the oldest completion if the ring is full
+		while (completion_head - shared->completions.tail >= RECONFIGURATION_SERVER_RING_SIZE);
+		completion = &shared->completions.entries[completion_head & (RECONFIGURATION_SERVER_RING_SIZE - 1)];
+		completion->id = request->id;
+		completion->status = status;
+		completion->cycles = end - start;
+
+		// The sequence is odd while the statistics are being updated
+		shared->statistics_sequence++;
+		dmb();
+		if (status == XST_SUCCESS) {
+			shared->statistics.completed_requests++;
+		} else {
+			shared->statistics.failed_requests++;
+		}
+		shared->statistics.busy_cycles += end - start;
+		dmb();
+		shared->statistics_sequence++;
+
+		dmb();
+		shared->completions.head = ++completion_head;
+		shared->requests.tail = ++request_tail;
+	}
+}
+
+static int execute_request(reconfiguration_request_t *request)
+{
+	if (request->x < 0 || request->x >= MAX_WIDTH_VIRTUAL_ARCHITECTURE || request->y < 0 || request->y >= MAX_HEIGHT_VIRTUAL_ARCHITECTURE) {
+		return XST_FAILURE;
+	}
+
+	switch (request->type) {
+		case RECONFIGURATION_REQUEST_CHANGE_POSITION:
+			return change_partition_position(&virtual_architecture, request->x, request->y, request->args[0], request->args[1]);
+		case RECONFIGURATION_REQUEST_CHANGE_ELEMENT:
+			return change_partition_element(&virtual_architecture, request->x, request->y, request->args[0]);
+		#if FINE_GRAIN
+		case RECONFIGURATION_REQUEST_ADD_STATIC_REGION:
+			return add_fine_grain_static_region(&virtual_architecture, request->x, request->y, request->args[0]);
+		case RECONFIGURATION_REQUEST_CHANGE_CONSTANT:
+			return change_partition_constant(&virtual_architecture, request->x, request->y, request->args[0], request->value);
+		case RECONFIGURATION_REQUEST_CHANGE_MUX:
+			return change_partition_mux(&virtual_architecture, request->x, request->y, request->args[0], request->args[1]);
+		case RECONFIGURATION_REQUEST_CHANGE_FU:
+			return change_partition_FU(&virtual_architecture, request->x, request->y, request->args[0], (FU_functions_t) request->args[1]);
+		case RECONFIGURATION_REQUEST_RECONFIGURE_FINE_GRAIN:
+			reconfigure_fine_grain();
+			return XST_SUCCESS;
+		#endif
+		default:
+			return XST_FAILURE;
+	}
+}
+
+#endif
@@ -0,0 +1,152 @@
+/*
+ * reconfiguration_server.h
+ *
+ * AMP deployment of the reconfiguration engine. CPU1 runs a reconfiguration
+ * server that owns the PCAP, the staging memory and the virtual architecture.
+ * CPU0 sends requests through a single-producer/single-consumer ring located
+ * in OCM and receives the completions through a second ring.
+ */
+
+#ifndef RECONFIGURATION_SERVER_H_
+#define RECONFIGURATION_SERVER_H_
+
+/***************************** Include Files ********************************/
+#include "xil_types.h"
+#include "IMPRESS_reconfiguration.h"
+
+#if RECONFIGURATION_SERVER
+
+/**************************** Constant Definitions *******************************/
+#define RECONFIGURATION_SERVER_READY       0x52454346 // Written by the server once the rings are initialized
+
+#define RECONFIGURATION_REQUEST_CHANGE_POSITION          0 // args: position_x, position_y
+#define RECONFIGURATION_REQUEST_CHANGE_ELEMENT           1 // args: num_element
+#if FINE_GRAIN
+#define RECONFIGURATION_REQUEST_ADD_STATIC_REGION        2 // args: num_element
+#define RECONFIGURATION_REQUEST_CHANGE_CONSTANT          3 // args: constant_number, value: constant value
+#define RECONFIGURATION_REQUEST_CHANGE_MUX               4 // args: mux_number, value
+#define RECONFIGURATION_REQUEST_CHANGE_FU                5 // args: FU_number, function
+#define RECONFIGURATION_REQUEST_RECONFIGURE_FINE_GRAIN   6 // no arguments
+#endif
+
+
+/**************************** Type Definitions *******************************/
+
+typedef struct {
+	u32 id;       // Assigned by reconfiguration_client_send
+	u32 type;     // One of the RECONFIGURATION_REQUEST_* values
+	int x;        // Partition of the virtual architecture
+	int y;
+	int args[2];
+	#if FINE_GRAIN
+	uint32_t value[MAX_WORDS_PER_CONSTANT];
+	#endif
+} reconfiguration_request_t;
+
+typedef struct {
+	u32 id;       // Id of the request that has been completed
+	int status;   // XST_SUCCESS or XST_FAILURE
+	u64 cycles;   // Time spent by the server executing the request (XTime cycles)
+} reconfiguration_completion_t;
+
+typedef struct {
+	u32 completed_requests;
+	u32 failed_requests;
+	u32 prefetched_PBS;    // PBS loaded by the server while it was idle
+	u64 busy_cycles;       // Total time spent executing requests (XTime cycles)
+} reconfiguration_server_statistics_t;
+
+typedef struct {
+	// Free running indexes: head is only written by the producer and tail by
+	// the consumer
+	volatile u32 head;
+	volatile u32 tail;
+	reconfiguration_request_t entries[RECONFIGURATION_SERVER_RING_SIZE];
+} reconfiguration_request_ring_t;
+
+typedef struct {
+	volatile u32 head;
+	volatile u32 tail;
+	reconfiguration_completion_t entries[RECONFIGURATION_SERVER_RING_SIZE];
+} reconfiguration_completion_ring_t;
+
+typedef struct {
+	volatile u32 ready;
+	reconfiguration_request_ring_t requests;
+	reconfiguration_completion_ring_t completions;
+	reconfiguration_server_statistics_t statistics; // Only written by the server
+	// Incremented by the server before and after updating the statistics, so
+	// the client can detect a copy torn by an update (the 64-bit counter can
+	// not be read atomically)
+	volatile u32 statistics_sequence;
+} reconfiguration_server_shared_t;
+
+
+/************************** Function Prototypes *****************************/
+
+/****************************************************************************/
+/**
+*
+* Initializes the reconfiguration engine and the shared rings and serves the
+* requests sent by CPU0. It must be called from the main function of CPU1 and
+* it never returns. When there are no pending requests and PBS_PREFETCH is
+* enabled the server prefetches the next PBS.
+*
+* @return	none
+*
+*****************************************************************************/
+void reconfiguration_server_run();
+
+/****************************************************************************/
+/**
+*
+* Waits until the reconfiguration server running on CPU1 is ready. It must be
+* called from CPU0 before sending any request.
+*
+* @return	none
+*
+*****************************************************************************/
+void reconfiguration_client_init();
+
+/****************************************************************************/
+/**
+*
+* Sends a request to the reconfiguration server. It does not wait for the
+* request to be executed.
+*
+* @param request is a pointer to the request. Its id field is filled by this
+*        function
+*
+* @return	id of the request or -1 if the request ring is full
+*
+*****************************************************************************/
+int reconfiguration_client_send(reconfiguration_request_t *request);
+
+/****************************************************************************/
+/**
+*
+* Obtains the next completion reported by the server. Requests are completed
+* in the same order they were sent.
+*
+* @param completion is a pointer where the completion is copied
+*
+* @return	1 if a completion has been obtained else 0
+*
+*****************************************************************************/
+int reconfiguration_client_get_completion(reconfiguration_completion_t *completion);
+
+/****************************************************************************/
+/**
+*
+* Copies the statistics of the reconfiguration server
+*
+* @param statistics is a pointer where the statistics are copied
+*
+* @return	none
+*
+*****************************************************************************/
+void reconfiguration_client_get_statistics(reconfiguration_server_statistics_t *statistics);
+
+#endif
+
+#endif /* RECONFIGURATION_SERVER_H_ */
@@ -0,0 +1,30 @@
+/*
+ * host_bsp.h
+ *
+ * Host stand-in of the parts of the Xilinx standalone BSP used by
+ * IMPRESS_reconfiguration.c, so its fine-grain layout can be tested without
+ * hardware (compile with -DPCAP_LINUX -Itest/bsp). The types come from the
+ * Linux backend of the PCAP engine. The fine-grain RE is not modelled: the
+ * tests must not send frames to it.
+ */
+
+#ifndef HOST_BSP_H_
+#define HOST_BSP_H_
+
+#include "reconfig_pcap_linux.h"
+
+#define XPAR_XDCFG_0_DEVICE_ID                  0
+#define XPAR_FINE_GRAIN_RE_0_S_CTRL_BASEADDR    0x43C00000
+#define XPAR_FINE_GRAIN_RE_0_S_MEM_BASEADDR     0x43C10000
+#define XPAR_FINE_GRAIN_RE_0_S_MEM_HIGHADDR     0x43C1FFFF
+
+#define COUNTS_PER_SECOND                       1000000
+
+typedef u64 XTime;
+
+static inline void XTime_SetTime(XTime time) { (void) time; }
+static inline void XTime_GetTime(XTime *time) { *time = 0; }
+static inline void XDcfg_SelectPcapInterface(XDcfg *InstancePtr) { (void) InstancePtr; }
+static inline void XDcfg_SelectIcapInterface(XDcfg *InstancePtr) { (void) InstancePtr; }
+
+#endif
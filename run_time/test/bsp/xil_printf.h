@@ -0,0 +1,2 @@
+/* Host stand-in of xil_printf.h (see host_bsp.h) */
+#include "host_bsp.h"
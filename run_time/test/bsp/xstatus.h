@@ -0,0 +1,2 @@
+/* Host stand-in of xstatus.h (see host_bsp.h) */
+#include "host_bsp.h"
@@ -0,0 +1,2 @@
+/* Host stand-in of xtime_l.h (see host_bsp.h) */
+#include "host_bsp.h"
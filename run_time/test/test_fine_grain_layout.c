@@ -0,0 +1,225 @@
+/*
+ * test_fine_grain_layout.c
+ *
+ * Host test of the fine-grain layout of an element that spans two clock region
+ * rows of the xc7z020. The run-time is included with its own parameters so
+ * that the static layout functions can be called, and the standalone BSP is
+ * replaced by the stand-ins of test/bsp. The test checks that the constant,
+ * mux and FU segments of each row get the frame address of the CLB column of
+ * that row and the words of the rows of the partition, and that a constant
+ * value is scattered to the bits of both frames.
+ *
+ * Build and run from run_time:
+ *   gcc -DPCAP_LINUX -I. -IFPGA_templates -Itest/bsp -o test_fine_grain_layout \
+ *       test/test_fine_grain_layout.c reconfig_pcap.c reconfig_pcap_linux.c \
+ *       FPGA_templates/device.c FPGA_templates/xc7z020.c FPGA_templates/7z100ffg900.c
+ *   ./test_fine_grain_layout
+ */
+
+/************************** Parameters of the test ***************************/
+// The run-time parameters are replaced by the ones of the test
+#define IMPRESS_RECONFIGURATION_PARAMETERS
+#define MAX_WIDTH_VIRTUAL_ARCHITECTURE    1
+#define MAX_HEIGHT_VIRTUAL_ARCHITECTURE   1
+#define NUM_ELEMENTS                      1
+#define INITIAL_ADDR_RAM                  0x11100000
+#define INITIAL_ADDR_RAM_SIZE             0
+#define PBS_CACHE                         0
+#define PBS_STORE                         0
+#define RECONFIGURATION_SERVER            0
+#define PARTITION_ALLOCATOR               0
+#define FINE_GRAIN                        1
+#define MAX_CONSTANTS                     1
+#define MAX_MUXES                         1
+#define MAX_FU                            1
+#define MAX_BITS_PER_CONSTANT             128
+#define MAX_COLUMNS_CONSTANTS             2
+#define MAX_COLUMNS_MUX                   2
+#define MAX_COLUMNS_FU                    2
+#define MAX_COLUMN_OFFSETS                1
+#define MAX_CLOCK_ROWS_PER_ELEMENT        2
+#define MAX_MUX_INPUTS                    4
+#define MAX_FINE_GRAIN_PARTITIONS         1
+#define MAX_FU_USER_FUNCTIONS             1
+#define FINE_GRAIN_SNAPSHOTS              0
+#define FINE_GRAIN_INTERRUPT              0
+#define FINE_GRAIN_PCAP_ROUTING           0
+
+/***************************** Include Files ********************************/
+#include "../IMPRESS_reconfiguration.c"
+
+
+/************************** Constant Definitions ****************************/
+#define TEST_X0           40
+#define TEST_Y0           40 // Rows 40 to 49 of clock region row 0 ...
+#define TEST_HEIGHT       20 // ... and rows 0 to 9 of clock region row 1
+#define TEST_FIRST_ROW    (TEST_Y0 % CLOCK_REGION_ROWS)
+#define TEST_LAST_ROW     ((TEST_Y0 + TEST_HEIGHT - 1) % CLOCK_REGION_ROWS)
+#define TEST_MUX_WIDTH    64 // One LUT per bit with 4 inputs
+
+
+/************************** Function Prototypes *****************************/
+static uint32_t expected_frame_address(int row, int column_number);
+static int expected_row(int first_unit, int units_in_first_row);
+static int check(int condition, const char *message);
+
+
+/************************** Variable Definitions ****************************/
+element_info_t elements[NUM_ELEMENTS] = {
+	{
+		.num_constants = 1,
+		.num_bits_in_constant = {128},
+		.constant_column_offset = {0},
+		.num_constant_columns = {1},
+		.num_muxes = 1,
+		.mux_data_width = {TEST_MUX_WIDTH},
+		.mux_num_inputs = {4},
+		.mux_column_offset = {0},
+		.num_mux_columns = {1},
+		.num_FU = 1,
+		.FU_4_bit_blocks = {8},
+		.FU_column_offset = {0},
+		.num_FU_columns = {1},
+		.PBS_name = "test.pbs",
+		.size = {6, TEST_HEIGHT}
+	}
+};
+
+static virtual_architecture_t va;
+static int failures;
+
+
+/************************** Function Definitions ****************************/
+
+int main(void)
+{
+	fine_grain_layout_t *layout;
+	constant_scatter_t *op;
+	fine_grain_segment_t *segment;
+	uint32_t value[MAX_WORDS_PER_CONSTANT];
+	uint32_t frame_address, *frame;
+	int i, bit, bits, row, slot_row[2];
+
+	va.partition[0][0].position[X_POS] = TEST_X0;
+	va.partition[0][0].position[Y_POS] = TEST_Y0;
+	va.partition[0][0].element.element_info = &elements[0];
+	update_partition_location_info(&va, 0, 0);
+	find_number_of_fine_grain_blocks();
+	init_frame_slot_map();
+	init_constant_frames();
+	init_mux_frames();
+	init_FU_frames();
+
+	if (!check(update_partition_fine_grain_info(&va, 0, 0) == XST_SUCCESS, "layout of an element spanning two clock region rows")) {
+		return 1;
+	}
+	layout = va.partition[0][0].element.fine_grain;
+	check(layout->num_constant_slots == 2 && layout->num_mux_slots == 2 && layout->num_FU_slots == 2, "one frame per component and row");
+
+	// Constant: column 0, 80 bits (rows 40 to 49) in row 0 and 48 bits in row 1
+	bits = 0;
+	for (i = 0; i < layout->num_constant_scatter_ops[0]; i++) {
+		op = &layout->constant_scatter[0][i];
+		row = expected_row(bits, 8 * (CLOCK_REGION_ROWS - TEST_FIRST_ROW));
+		frame_address = constant_t_frames[op->frame_address_position].frame_address;
+		check(frame_address == expected_frame_address(row, 0), "constant segment frame address");
+		check(op->dst_word >= (row == 0 ? 8 * TEST_FIRST_ROW / 32 : 0) && op->dst_word <= (row == 0 ? (8 * CLOCK_REGION_ROWS - 1) / 32 : (8 * (TEST_LAST_ROW + 1) - 1) / 32), "constant segment words");
+		bits += __builtin_popcount(op->mask);
+	}
+	check(bits == 128, "every bit of the constant is placed");
+
+	// Every bit of the constant lands in the bits of the rows of the partition
+	memset(value, 0xFF, sizeof(value));
+	change_partition_constant(&va, 0, 0, 0, value);
+	for (row = 0; row < 2; row++) {
+		slot_row[row] = -1;
+		for (i = 0; i < layout->num_constant_slots; i++) {
+			if (constant_t_frames[layout->constant_slots[i]].frame_address == expected_frame_address(row, 0)) {
+				slot_row[row] = layout->constant_slots[i];
+			}
+		}
+		check(slot_row[row] != -1, "constant frame of each row");
+	}
+	if (slot_row[0] != -1 && slot_row[1] != -1) {
+		for (bit = 0; bit < WORDS_PER_CONSTANTS * 32; bit++) {
+			frame = constant_t_frames[slot_row[0]].value;
+			check(((frame[bit / 32] >> (bit % 32)) & 0x1) == (bit >= 8 * TEST_FIRST_ROW && bit < 8 * CLOCK_REGION_ROWS), "constant bits in row 0");
+			frame = constant_t_frames[slot_row[1]].value;
+			check(((frame[bit / 32] >> (bit % 32)) & 0x1) == (bit < 48), "constant bits in row 1");
+		}
+	}
+
+	// Mux: column 1, 40 LUTs (rows 40 to 49) in row 0 and 24 LUTs in row 1
+	bits = 0;
+	for (i = 0; i < layout->num_mux_segments[0]; i++) {
+		segment = &layout->mux_segments[0][i];
+		row = expected_row(bits / 2, 4 * (CLOCK_REGION_ROWS - TEST_FIRST_ROW));
+		frame_address = mux_t_frames[segment->frame_address_position].frame_address;
+		check(frame_address == expected_frame_address(row, 1), "mux segment frame address");
+		check(segment->word >= (row == 0 ? 4 * TEST_FIRST_ROW / 16 : 0) && segment->word <= (row == 0 ? (4 * CLOCK_REGION_ROWS - 1) / 16 : (4 * (TEST_LAST_ROW + 1) - 1) / 16), "mux segment words");
+		bits += __builtin_popcount(segment->mask);
+	}
+	check(bits == 2 * TEST_MUX_WIDTH, "every LUT of the mux is placed");
+
+	// FU: column 2, 10 blocks (rows 40 to 49) in row 0 and 6 blocks in row 1
+	bits = 0;
+	for (i = 0; i < layout->num_FU_segments[0]; i++) {
+		segment = &layout->FU_segments[0][i];
+		row = expected_row(bits / BITS_PER_BLOCK, CLOCK_REGION_ROWS - TEST_FIRST_ROW);
+		frame_address = FU_t_frames[segment->frame_address_position].frame_address;
+		check(frame_address == expected_frame_address(row, 2), "FU segment frame address");
+		check(segment->word >= (row == 0 ? TEST_FIRST_ROW / BLOCK_PER_WORD : 0) && segment->word <= (row == 0 ? (CLOCK_REGION_ROWS - 1) / BLOCK_PER_WORD : TEST_LAST_ROW / BLOCK_PER_WORD), "FU segment words");
+		bits += __builtin_popcount(segment->mask);
+	}
+	check(bits == 16 * BITS_PER_BLOCK, "every block of the FU is placed");
+
+	// The frames go back to the free lists with the layout
+	release_partition_fine_grain(&va, 0, 0);
+	check(num_constant_free_frames == 2 && num_mux_free_frames == 2 && num_FU_free_frames == 2, "frames released with the layout");
+	for (i = 0; i < FRAME_SLOT_MAP_SIZE; i++) {
+		check(frame_slot_map[i].slot < 0, "frames removed from the frame map");
+	}
+
+	printf("%s: %d failed checks\n", failures ? "FAIL" : "PASS", failures);
+	return failures != 0;
+}
+
+/*
+ * Model of the placement: the n-th column of the element is a slice of the
+ * (n / 2)-th CLB column of the partition in the clock region row
+ */
+static uint32_t expected_frame_address(int row, int column_number)
+{
+	int column, CLB_columns, minor;
+
+	CLB_columns = 0;
+	for (column = TEST_X0; column < TEST_X0 + elements[0].size[WIDTH_POS]; column++) {
+		if (DEVICE_TYPE(row, column) != CLB_L_TYPE && DEVICE_TYPE(row, column) != CLB_M_TYPE) {
+			continue;
+		}
+		if (CLB_columns++ == column_number / 2) {
+			if (column_number % 2 == 1) {
+				minor = 26;
+			} else {
+				minor = (DEVICE_TYPE(row, column) == CLB_L_TYPE) ? 32 : 34;
+			}
+			return PCAP_SetupFarRow(PCAP_FAR_CLB_BLOCK, row, column, minor);
+		}
+	}
+	return 0xFFFFFFFF;
+}
+
+// The units of a component fill the rows of the partition in row 0 first
+static int expected_row(int first_unit, int units_in_first_row)
+{
+	return (first_unit < units_in_first_row) ? 0 : 1;
+}
+
+static int check(int condition, const char *message)
+{
+	if (!condition) {
+		printf("FAIL: %s\n", message);
+		failures++;
+	}
+	return condition;
+}
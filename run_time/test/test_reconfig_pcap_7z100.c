@@ -0,0 +1,198 @@
+/*
+ * test_reconfig_pcap_7z100.c
+ *
+ * Host test of the readback/merge/write engine with the 7z100 description.
+ * The Linux backend is used with a regular file as stand-in of the
+ * configuration memory, so no hardware is needed. Each case writes a PBS in a
+ * region and checks every frame of the device against a model of the merge:
+ * the words of the region take the PBS contents, the clock words and the rest
+ * of the device keep their previous contents.
+ *
+ * Build and run from run_time:
+ *   gcc -DPCAP_LINUX -I. -IFPGA_templates -o test_reconfig_pcap_7z100 \
+ *       test/test_reconfig_pcap_7z100.c reconfig_pcap.c reconfig_pcap_linux.c \
+ *       FPGA_templates/device.c FPGA_templates/xc7z020.c FPGA_templates/7z100ffg900.c
+ *   ./test_reconfig_pcap_7z100
+ */
+
+/***************************** Include Files ********************************/
+#include "reconfig_pcap.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// FPGA description file
+#include "device.h"
+#include "series7.h"
+#include "7z100ffg900.h"
+
+
+/************************** Constant Definitions ****************************/
+#define TEST_CONFIG_MEMORY  "test_reconfig_pcap_7z100.bin"
+#define TEST_MAX_PBS_WORDS  (PCAP_MAX_PBLOCKS * MAX_ROWS * MAX_ROW_FRAMES * MAX_FRAME_WORDS)
+
+
+/************************** Function Prototypes *****************************/
+static void fill_config_memory(XDcfg *InstancePtr);
+static u32 model_write(u32 *memory, u32 *PBS, pblock pblock_list[], u32 num_pblocks);
+static u32 column_first_frame(u32 y, u32 x);
+static int run_case(const char *name, pblock pblock_list[], u32 num_pblocks);
+
+
+/************************** Variable Definitions ****************************/
+static XDcfg pcap;
+static u32 *staging;
+static u32 *PBS;
+static u32 *expected;
+static u32 PBS_seed;
+
+
+/************************** Function Definitions ****************************/
+
+int main(void)
+{
+	pblock bottom_middle = {20, 10, 30, 39};     // Crosses the middle of a bottom row
+	pblock bottom_low = {20, 100, 30, 119};      // Lower half of a bottom row
+	pblock bottom_high = {20, 230, 30, 249};     // Upper half of a bottom row
+	pblock top = {40, 310, 60, 339};             // Top row
+	pblock all_rows = {20, 0, 24, 349};          // Every clock region row
+	pblock boundary = {50, 270, 70, 329};        // Last bottom row and top row
+	pblock two_pblocks[2] = {{20, 0, 22, 349}, {60, 0, 61, 349}};
+	pblock too_many[PCAP_MAX_PBLOCKS + 1];
+	int failures = 0;
+	u32 i;
+
+	unlink(TEST_CONFIG_MEMORY);
+	setenv(PCAP_LINUX_IDCODE_ENV, "0x03736093", 1);
+	if (PCAP_Initialize_device(&pcap, TEST_CONFIG_MEMORY) != XST_SUCCESS || fpga_device != &xc7z100_device) {
+		printf("FAIL: 7z100 stand-in not initialized\n");
+		return 1;
+	}
+
+	staging = PCAP_alloc_staging_memory(PCAP_MAX_PBLOCKS * MAX_ROWS * (MAX_ROW_FRAMES + 2) * FRAME_BYTES);
+	PBS = malloc(TEST_MAX_PBS_WORDS * sizeof(u32));
+	expected = malloc(pcap.config_memory_frames * FRAME_BYTES);
+	if (staging == NULL || PBS == NULL || expected == NULL) {
+		printf("FAIL: memory not allocated\n");
+		return 1;
+	}
+	fill_config_memory(&pcap);
+
+	failures += run_case("sub-clock-region across the middle of a bottom row", &bottom_middle, 1);
+	failures += run_case("sub-clock-region in the lower half of a bottom row", &bottom_low, 1);
+	failures += run_case("sub-clock-region in the upper half of a bottom row", &bottom_high, 1);
+	failures += run_case("sub-clock-region in the top row", &top, 1);
+	failures += run_case("region spanning all seven rows", &all_rows, 1);
+	// The clock words of the previous write are reused instead of read back
+	failures += run_case("region spanning all seven rows (clock words cached)", &all_rows, 1);
+	failures += run_case("region crossing the bottom/top boundary", &boundary, 1);
+	failures += run_case("two pblocks spanning all seven rows", two_pblocks, 2);
+
+	for (i = 0; i < PCAP_MAX_PBLOCKS + 1; i++) {
+		too_many[i] = bottom_low;
+	}
+	if (write_subclock_region_PBS_from_RAM(&pcap, staging, PBS, (UINTPTR) PBS, too_many, PCAP_MAX_PBLOCKS + 1, 0, 0) != XST_FAILURE) {
+		printf("FAIL: more than PCAP_MAX_PBLOCKS pblocks accepted\n");
+		failures++;
+	} else {
+		printf("PASS: more than PCAP_MAX_PBLOCKS pblocks rejected\n");
+	}
+
+	unlink(TEST_CONFIG_MEMORY);
+	return failures != 0;
+}
+
+/*
+ * Every word of the stand-in gets a different value so that a word written in
+ * the wrong position is detected
+ */
+static void fill_config_memory(XDcfg *InstancePtr)
+{
+	u32 i;
+
+	for (i = 0; i < InstancePtr->config_memory_frames * FRAME_WORDS; i++) {
+		InstancePtr->config_memory[i] = i * 2654435761u;
+	}
+}
+
+static u32 column_first_frame(u32 y, u32 x)
+{
+	u32 i, frames;
+
+	frames = 0;
+	for (i = 0; i < y * fpga_device->columns + x; i++) {
+		frames += DEVICE_FRAMES(i / fpga_device->columns, i % fpga_device->columns);
+	}
+
+	return frames;
+}
+
+/*
+ * Generates the PBS of the region and applies it to the expected contents of the
+ * configuration memory. The PBS holds, for each clock region row of each pblock
+ * and each frame of its columns, the words of the rows of the pblock without the
+ * clock words. The frames of the CLK and CFG columns that do not belong to the
+ * interconnect are in the PBS but they are not written.
+ *
+ * Returns the words of the PBS
+ */
+static u32 model_write(u32 *memory, u32 *PBS, pblock pblock_list[], u32 num_pblocks)
+{
+	u32 i, y, x, frame, word, first_word, last_word, frame_index, num_frames, PBS_words;
+	u32 half_words;
+
+	half_words = (FRAME_WORDS - FRAME_CLOCK_WORDS) / 2;
+	PBS_words = 0;
+	for (i = 0; i < num_pblocks; i++) {
+		for (y = pblock_list[i].Y0 / CLOCK_REGION_ROWS; y <= pblock_list[i].Yf / CLOCK_REGION_ROWS; y++) {
+			first_word = 0;
+			last_word = 2 * half_words;
+			if (y == pblock_list[i].Y0 / CLOCK_REGION_ROWS) {
+				first_word = ROWS_TO_WORDS(pblock_list[i].Y0 % CLOCK_REGION_ROWS);
+			}
+			if (y == pblock_list[i].Yf / CLOCK_REGION_ROWS) {
+				last_word = ROWS_TO_WORDS(pblock_list[i].Yf % CLOCK_REGION_ROWS + 1);
+			}
+			for (x = pblock_list[i].X0; x <= pblock_list[i].Xf; x++) {
+				frame_index = column_first_frame(y, x);
+				num_frames = DEVICE_FRAMES(y, x);
+				if (DEVICE_TYPE(y, x) == CLK_TYPE || DEVICE_TYPE(y, x) == CFG_TYPE) {
+					num_frames = CLK_INTERCONNECT_FRAMES;
+				}
+				for (frame = 0; frame < DEVICE_FRAMES(y, x); frame++) {
+					for (word = first_word; word < last_word; word++) {
+						PBS[PBS_words] = PBS_seed++ | 0x80000000;
+						if (frame < num_frames) {
+							memory[(frame_index + frame) * FRAME_WORDS + word + (word < half_words ? 0 : FRAME_CLOCK_WORDS)] = PBS[PBS_words];
+						}
+						PBS_words++;
+					}
+				}
+			}
+		}
+	}
+
+	return PBS_words;
+}
+
+static int run_case(const char *name, pblock pblock_list[], u32 num_pblocks)
+{
+	u32 PBS_words, i;
+
+	memcpy(expected, pcap.config_memory, pcap.config_memory_frames * FRAME_BYTES);
+	PBS_words = model_write(expected, PBS, pblock_list, num_pblocks);
+
+	if (write_subclock_region_PBS_from_RAM(&pcap, staging, PBS, (UINTPTR) &PBS[PBS_words], pblock_list, num_pblocks, 0, 0) != XST_SUCCESS) {
+		printf("FAIL: %s (write failed)\n", name);
+		return 1;
+	}
+	for (i = 0; i < pcap.config_memory_frames * FRAME_WORDS; i++) {
+		if (pcap.config_memory[i] != expected[i]) {
+			printf("FAIL: %s (frame %u word %u is 0x%08x instead of 0x%08x)\n", name, i / FRAME_WORDS, i % FRAME_WORDS, pcap.config_memory[i], expected[i]);
+			return 1;
+		}
+	}
+
+	printf("PASS: %s\n", name);
+	return 0;
+}